@@ -0,0 +1,424 @@
+//
+// Created by robcholz on 11/15/23.
+//
+
+#include <deque>
+#include <list>
+#include <queue>
+#include <stack>
+#include <unordered_map>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "container/base/StaticArray.hpp"
+#include "container/base/DynamicArray.hpp"
+#include "container/base/StaticList.hpp"
+#include "container/base/DynamicList.hpp"
+#include "container/base/IntrusiveList.hpp"
+#include "container/base/StaticRingBuffer.hpp"
+#include "container/base/DynamicRingBuffer.hpp"
+#include "container/base/StaticHashMap.hpp"
+#include "container/base/DynamicHashMap.hpp"
+#include "container/Deque.hpp"
+#include "container/Queue.hpp"
+#include "container/Stack.hpp"
+#include "container/SPSCQueue.hpp"
+#include "container/FlatMap.hpp"
+#include "utils/Types.hpp"
+#include "utils/Views.hpp"
+
+
+namespace {
+	constexpr rsl::size_t MAX_ELEMENTS = 512;
+
+	// gives the std containers the method names of rsl, so every benchmark below runs on both unchanged
+	template<typename STD_CONTAINER>
+	struct StdSequence : STD_CONTAINER {
+		using T = typename STD_CONTAINER::value_type;
+
+		void addFront(const T& element) { this->push_front(element); }
+
+		void addBack(const T& element) { this->push_back(element); }
+
+		void add(rsl::size_t index, const T& element) { this->insert(this->begin() + index, element); }
+
+		void popFront() { this->pop_front(); }
+
+		void popBack() { this->pop_back(); }
+
+		void empty() { this->clear(); }
+
+		bool isEmpty() const { return this->size() == 0; }
+
+		rsl::size_t length() const { return this->size(); }
+	};
+
+	template<typename STD_ADAPTER>
+	struct StdAdapter : STD_ADAPTER {
+		void add(int element) { this->push(element); }
+	};
+
+	using StaticArray = rsl::StaticArray<int, MAX_ELEMENTS>;
+	using DynamicArray = rsl::DynamicArray<int>;
+	using SmallArray = rsl::SmallArray<int>;
+	using StaticList = rsl::StaticList<int, MAX_ELEMENTS>;
+	using DynamicList = rsl::DynamicList<int>;
+	using StaticRingBuffer = rsl::StaticRingBuffer<int, MAX_ELEMENTS>;
+	using DynamicRingBuffer = rsl::DynamicRingBuffer<int, MAX_ELEMENTS>;
+	using Deque = rsl::Deque<int>;
+	using ArrayDeque = rsl::Deque<int, 10, rsl::DynamicArray<int>>;
+	using StdVector = StdSequence<std::vector<int>>;
+	using StdDeque = StdSequence<std::deque<int>>;
+	using StdList = StdSequence<std::list<int>>;
+
+	struct StdUnorderedMap : std::unordered_map<int, int> {
+		bool put(int key, int value) {
+			(*this)[key] = value;
+			return true;
+		}
+
+		const int* find(int key) const {
+			auto found = std::unordered_map<int, int>::find(key);
+			return found == this->end() ? nullptr : &found->second;
+		}
+	};
+
+	// the linear search lookup tables used before there was a hash map
+	struct ListMap {
+		bool put(int key, int) {
+			list.addBack(key);
+			return true;
+		}
+
+		const int* find(int key) const { return list.contains(key) ? &found : nullptr; }
+
+		rsl::DynamicList<int> list;
+		int found{0};
+	};
+
+	using StaticHashMap = rsl::StaticHashMap<int, int, MAX_ELEMENTS>;
+	using DynamicHashMap = rsl::DynamicHashMap<int, int>;
+	using FlatMap = rsl::FlatMap<int, int, MAX_ELEMENTS>;
+
+	using ListQueue = rsl::Queue<int>;
+	using RingBufferQueue = rsl::Queue<int, MAX_ELEMENTS, rsl::StaticRingBuffer<int, MAX_ELEMENTS>>;
+	using StdQueue = StdAdapter<std::queue<int>>;
+	using ListStack = rsl::Stack<int>;
+	using RingBufferStack = rsl::Stack<int, MAX_ELEMENTS, rsl::StaticRingBuffer<int, MAX_ELEMENTS>>;
+	using StdStack = StdAdapter<std::stack<int>>;
+	using BinaryHeap = rsl::DynamicPriorityQueue<int>;
+	using QuaternaryHeap = rsl::DynamicPriorityQueue<int, 10, std::less<int>, 4>;
+	using StdPriorityQueue = StdAdapter<std::priority_queue<int>>;
+
+	struct Timer : rsl::IntrusiveListHook<> {
+		int deadline;
+
+		Timer(int deadline = 0) : deadline(deadline) {}
+	};
+}
+
+template<typename CONTAINER>
+static void PushPopBack(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	CONTAINER container;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			container.addBack(i);
+		for (int i = 0; i < elements; ++i)
+			container.popBack();
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+template<typename CONTAINER>
+static void PushPopFront(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	CONTAINER container;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			container.addFront(i);
+		for (int i = 0; i < elements; ++i)
+			container.popFront();
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+// every insert lands in the middle, so half of the elements have to be shifted each time
+template<typename CONTAINER>
+static void InsertMiddle(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	CONTAINER container;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			container.add(container.length() / 2, i);
+		container.empty();
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template<typename CONTAINER>
+static void Iterate(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	CONTAINER container;
+	for (int i = 0; i < elements; ++i)
+		container.addBack(i);
+	for (auto _: state) {
+		long sum = 0;
+		for (int element: container)
+			sum += element;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+// short lived arrays that stay small, the common case in the filters and pipelines
+template<typename CONTAINER>
+static void ConstructFill(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	for (auto _: state) {
+		CONTAINER container;
+		for (int i = 0; i < elements; ++i)
+			container.addBack(i);
+		benchmark::DoNotOptimize(container.length());
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+template<typename QUEUE>
+static void QueueAddPop(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	QUEUE queue;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			queue.add(i);
+		for (int i = 0; i < elements; ++i) {
+			benchmark::DoNotOptimize(queue.front());
+			queue.pop();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+template<typename STACK>
+static void StackAddPop(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	STACK stack;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			stack.add(i);
+		for (int i = 0; i < elements; ++i) {
+			benchmark::DoNotOptimize(stack.top());
+			stack.pop();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+// deadlines arrive out of order, like events in a scheduler
+template<typename QUEUE>
+static void PriorityAddPop(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	QUEUE queue;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			queue.add((i * 7919) % elements);
+		for (int i = 0; i < elements; ++i) {
+			benchmark::DoNotOptimize(queue.top());
+			queue.pop();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+// sparse ids like sensor ids, half of the lookups miss
+template<typename MAP>
+static void MapFind(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	MAP map;
+	for (int i = 0; i < elements; ++i)
+		map.put(i * 16, i);
+	int key = 0;
+	for (auto _: state) {
+		benchmark::DoNotOptimize(map.find(key));
+		key = (key + 8) % (elements * 16);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+template<typename MAP>
+static void MapPutRemove(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	MAP map;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			map.put(i * 16, i);
+		for (int i = 0; i < elements; ++i)
+			map.remove(i * 16);
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+// timers that live elsewhere are queued and expired, the node based lists allocate a node and copy the timer each time
+static void TimerLinkUnlink(benchmark::State& state) {
+	const auto elements = static_cast<rsl::size_t>(state.range(0));
+	std::vector<Timer> timers(elements);
+	rsl::IntrusiveList<Timer> list;
+	for (auto _: state) {
+		for (auto& timer: timers)
+			list.addBack(timer);
+		while (!list.isEmpty()) {
+			benchmark::DoNotOptimize(list.front().deadline);
+			list.popFront();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(elements) * 2);
+}
+
+template<typename LIST>
+static void TimerCopyPop(benchmark::State& state) {
+	const auto elements = static_cast<rsl::size_t>(state.range(0));
+	std::vector<Timer> timers(elements);
+	LIST list;
+	for (auto _: state) {
+		for (auto& timer: timers)
+			list.addBack(timer);
+		while (!list.isEmpty()) {
+			benchmark::DoNotOptimize(list.front().deadline);
+			list.popFront();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(elements) * 2);
+}
+
+// squares of the valid samples of a window, every second one, with a temporary array per step
+static void FeatureMaterialized(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	rsl::DynamicArray<int> samples;
+	for (int i = 0; i < elements; ++i)
+		samples.addBack((i * 7919) % 201 - 100);
+	for (auto _: state) {
+		rsl::DynamicArray<int> valid;
+		rsl::DynamicArray<int> squared;
+		rsl::DynamicArray<int> strided;
+		for (int sample: samples) {
+			if (sample >= 0)
+				valid.addBack(sample);
+		}
+		for (int sample: valid)
+			squared.addBack(sample * sample);
+		for (rsl::size_t i = 0; i < squared.length(); i += 2)
+			strided.addBack(squared.get(i));
+		long sum = 0;
+		for (int feature: strided)
+			sum += feature;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+// the same feature through lazy views, one pass and no allocation
+static void FeatureFused(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	rsl::DynamicArray<int> samples;
+	for (int i = 0; i < elements; ++i)
+		samples.addBack((i * 7919) % 201 - 100);
+	for (auto _: state) {
+		long sum = 0;
+		for (int feature: samples | rsl::views::filter([](int sample) { return sample >= 0; })
+		                  | rsl::views::transform([](int sample) { return sample * sample; })
+		                  | rsl::views::stride(2))
+			sum += feature;
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+// single threaded, shows the cost of the atomics against the plain queues above
+static void SPSCQueuePushPop(benchmark::State& state) {
+	const auto elements = static_cast<int>(state.range(0));
+	rsl::SPSCQueue<int, MAX_ELEMENTS> queue;
+	int element = 0;
+	for (auto _: state) {
+		for (int i = 0; i < elements; ++i)
+			queue.push(i);
+		for (int i = 0; i < elements; ++i)
+			queue.pop(element);
+		benchmark::DoNotOptimize(element);
+	}
+	state.SetItemsProcessed(state.iterations() * elements * 2);
+}
+
+#define RSL_CONTAINER_BENCHMARK(NAME, CONTAINER) \
+	BENCHMARK_TEMPLATE(NAME, CONTAINER)->RangeMultiplier(8)->Range(8, MAX_ELEMENTS)
+
+RSL_CONTAINER_BENCHMARK(PushPopBack, StaticArray);
+RSL_CONTAINER_BENCHMARK(PushPopBack, DynamicArray);
+RSL_CONTAINER_BENCHMARK(PushPopBack, StaticList);
+RSL_CONTAINER_BENCHMARK(PushPopBack, DynamicList);
+RSL_CONTAINER_BENCHMARK(PushPopBack, StaticRingBuffer);
+RSL_CONTAINER_BENCHMARK(PushPopBack, DynamicRingBuffer);
+RSL_CONTAINER_BENCHMARK(PushPopBack, Deque);
+RSL_CONTAINER_BENCHMARK(PushPopBack, StdVector);
+RSL_CONTAINER_BENCHMARK(PushPopBack, StdDeque);
+RSL_CONTAINER_BENCHMARK(PushPopBack, StdList);
+
+RSL_CONTAINER_BENCHMARK(PushPopFront, StaticList);
+RSL_CONTAINER_BENCHMARK(PushPopFront, DynamicList);
+RSL_CONTAINER_BENCHMARK(PushPopFront, StaticRingBuffer);
+RSL_CONTAINER_BENCHMARK(PushPopFront, DynamicRingBuffer);
+RSL_CONTAINER_BENCHMARK(PushPopFront, Deque);
+RSL_CONTAINER_BENCHMARK(PushPopFront, ArrayDeque);
+RSL_CONTAINER_BENCHMARK(PushPopFront, StdDeque);
+RSL_CONTAINER_BENCHMARK(PushPopFront, StdList);
+
+BENCHMARK_TEMPLATE(ConstructFill, DynamicArray)->Arg(4)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(ConstructFill, SmallArray)->Arg(4)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(ConstructFill, StdVector)->Arg(4)->Arg(8)->Arg(64);
+
+RSL_CONTAINER_BENCHMARK(InsertMiddle, StaticArray);
+RSL_CONTAINER_BENCHMARK(InsertMiddle, DynamicArray);
+RSL_CONTAINER_BENCHMARK(InsertMiddle, StdVector);
+
+RSL_CONTAINER_BENCHMARK(Iterate, StaticArray);
+RSL_CONTAINER_BENCHMARK(Iterate, DynamicArray);
+RSL_CONTAINER_BENCHMARK(Iterate, StaticList);
+RSL_CONTAINER_BENCHMARK(Iterate, DynamicList);
+RSL_CONTAINER_BENCHMARK(Iterate, StaticRingBuffer);
+RSL_CONTAINER_BENCHMARK(Iterate, DynamicRingBuffer);
+RSL_CONTAINER_BENCHMARK(Iterate, Deque);
+RSL_CONTAINER_BENCHMARK(Iterate, StdVector);
+RSL_CONTAINER_BENCHMARK(Iterate, StdDeque);
+RSL_CONTAINER_BENCHMARK(Iterate, StdList);
+
+BENCHMARK(TimerLinkUnlink)->RangeMultiplier(8)->Range(8, MAX_ELEMENTS);
+RSL_CONTAINER_BENCHMARK(TimerCopyPop, rsl::DynamicList<Timer>);
+RSL_CONTAINER_BENCHMARK(TimerCopyPop, StdSequence<std::list<Timer>>);
+
+RSL_CONTAINER_BENCHMARK(MapFind, StaticHashMap);
+RSL_CONTAINER_BENCHMARK(MapFind, DynamicHashMap);
+RSL_CONTAINER_BENCHMARK(MapFind, FlatMap);
+RSL_CONTAINER_BENCHMARK(MapFind, StdUnorderedMap);
+RSL_CONTAINER_BENCHMARK(MapFind, ListMap);
+
+RSL_CONTAINER_BENCHMARK(MapPutRemove, StaticHashMap);
+RSL_CONTAINER_BENCHMARK(MapPutRemove, DynamicHashMap);
+RSL_CONTAINER_BENCHMARK(MapPutRemove, FlatMap);
+
+RSL_CONTAINER_BENCHMARK(QueueAddPop, ListQueue);
+RSL_CONTAINER_BENCHMARK(QueueAddPop, RingBufferQueue);
+RSL_CONTAINER_BENCHMARK(QueueAddPop, StdQueue);
+
+RSL_CONTAINER_BENCHMARK(StackAddPop, ListStack);
+RSL_CONTAINER_BENCHMARK(StackAddPop, RingBufferStack);
+RSL_CONTAINER_BENCHMARK(StackAddPop, StdStack);
+
+RSL_CONTAINER_BENCHMARK(PriorityAddPop, BinaryHeap);
+RSL_CONTAINER_BENCHMARK(PriorityAddPop, QuaternaryHeap);
+RSL_CONTAINER_BENCHMARK(PriorityAddPop, StdPriorityQueue);
+
+BENCHMARK(FeatureMaterialized)->RangeMultiplier(8)->Range(8, MAX_ELEMENTS);
+BENCHMARK(FeatureFused)->RangeMultiplier(8)->Range(8, MAX_ELEMENTS);
+
+BENCHMARK(SPSCQueuePushPop)->RangeMultiplier(8)->Range(8, MAX_ELEMENTS);
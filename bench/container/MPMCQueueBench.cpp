@@ -0,0 +1,50 @@
+//
+// Created by robcholz on 11/11/23.
+//
+
+#include <mutex>
+#include "benchmark/benchmark.h"
+#include "container/MPMCQueue.hpp"
+#include "container/Queue.hpp"
+#include "container/base/StaticRingBuffer.hpp"
+
+
+namespace {
+	constexpr rsl::size_t QUEUE_CAPACITY = 1024;
+
+	rsl::MPMCQueue<long, QUEUE_CAPACITY> lockFreeQueue;
+
+	std::mutex queueMutex;
+	rsl::Queue<long, QUEUE_CAPACITY, rsl::StaticRingBuffer<long, QUEUE_CAPACITY>> lockedQueue;
+}
+
+// every thread adds and pops in turn, so producers and consumers contend on the same queue
+static void MPMCQueueAddPop(benchmark::State& state) {
+	long element = 0;
+	for (auto _: state) {
+		lockFreeQueue.add(element);
+		lockFreeQueue.pop(element);
+		benchmark::DoNotOptimize(element);
+	}
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+static void MutexQueueAddPop(benchmark::State& state) {
+	long element = 0;
+	for (auto _: state) {
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			lockedQueue.add(element);
+		}
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			element = lockedQueue.front();
+			lockedQueue.pop();
+		}
+		benchmark::DoNotOptimize(element);
+	}
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(MPMCQueueAddPop)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(MutexQueueAddPop)->ThreadRange(1, 16)->UseRealTime();
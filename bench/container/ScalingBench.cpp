@@ -0,0 +1,80 @@
+//
+// Created by robcholz on 11/14/23.
+//
+
+#include "benchmark/benchmark.h"
+#include "container/base/StaticArray.hpp"
+#include "container/base/DynamicArray.hpp"
+#include "container/base/StaticList.hpp"
+#include "container/base/DynamicList.hpp"
+#include "stream/Pipeline.hpp"
+
+
+// every thread works on its own containers, with no shared state the items per second should grow with the thread count
+
+static void StaticArrayPerThread(benchmark::State& state) {
+	rsl::StaticArray<int, 256> array;
+	for (auto _: state) {
+		for (int i = 0; i < 128; ++i)
+			array.add(static_cast<rsl::size_t>(i / 2), i);
+		for (int i = 0; i < 128; ++i)
+			array.searchRemove(i);
+		benchmark::DoNotOptimize(array.getRowArray());
+	}
+	state.SetItemsProcessed(state.iterations() * 256);
+}
+
+static void DynamicArrayPerThread(benchmark::State& state) {
+	rsl::DynamicArray<int, 4> array;
+	for (auto _: state) {
+		for (int i = 0; i < 128; ++i)
+			array.addBack(i);
+		array.removeRange(0, 63);
+		benchmark::DoNotOptimize(array.indexOf(100));
+		array.empty();
+	}
+	state.SetItemsProcessed(state.iterations() * 128);
+}
+
+static void StaticListPerThread(benchmark::State& state) {
+	rsl::StaticList<int, 128> list;
+	for (auto _: state) {
+		for (int i = 0; i < 128; ++i)
+			list.addFront(i);
+		for (int i = 0; i < 128; ++i)
+			list.popBack();
+		benchmark::DoNotOptimize(list.length());
+	}
+	state.SetItemsProcessed(state.iterations() * 256);
+}
+
+static void DynamicListPerThread(benchmark::State& state) {
+	rsl::DynamicList<int> list;
+	for (auto _: state) {
+		for (int i = 0; i < 128; ++i)
+			list.addBack(i);
+		list.searchRemove(64);
+		list.empty();
+		benchmark::DoNotOptimize(list.length());
+	}
+	state.SetItemsProcessed(state.iterations() * 128);
+}
+
+static void PipelinePerThread(benchmark::State& state) {
+	using Pipeline = rsl::Pipeline<int, float>;
+	Pipeline pipeline;
+	pipeline.filter(Pipeline::Filter::constrainedAverage<4>);
+	int sample = 0;
+	for (auto _: state) {
+		pipeline.add(sample++ & 31);
+		pipeline.update();
+		benchmark::DoNotOptimize(pipeline.output());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(StaticArrayPerThread)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(DynamicArrayPerThread)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(StaticListPerThread)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(DynamicListPerThread)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(PipelinePerThread)->ThreadRange(1, 16)->UseRealTime();
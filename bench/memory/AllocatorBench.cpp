@@ -0,0 +1,121 @@
+//
+// Created by robcholz on 11/15/23.
+//
+
+#include <cstdlib>
+#include <memory>
+#include "benchmark/benchmark.h"
+#include "memory/ObjectAllocator.hpp"
+#include "memory/ByteAllocator.hpp"
+#include "memory/HeapAllocator.hpp"
+#include "memory/SlabAllocator.hpp"
+#include "memory/MonotonicArena.hpp"
+#include "memory/ThreadCache.hpp"
+
+
+namespace {
+	constexpr rsl::size_t MAX_OBJECTS = 512;
+
+	// about the size of a list node holding a small payload
+	struct Object {
+		double payload[4];
+	};
+
+	template<typename T>
+	struct StdAllocator {
+		T* malloc() { return allocator.allocate(1); }
+
+		void free(rsl::ptr_t ptr) { allocator.deallocate(static_cast<T*>(ptr), 1); }
+
+		std::allocator<T> allocator;
+	};
+
+	template<typename T>
+	struct SystemAllocator {
+		T* malloc(rsl::size_t size = sizeof(T)) { return static_cast<T*>(std::malloc(size)); }
+
+		void free(rsl::ptr_t ptr) { std::free(ptr); }
+	};
+
+	using ObjectAllocator = rsl::ObjectAllocator<Object>;
+	using CachedObjectAllocator = rsl::ObjectAllocator<Object, -1, rsl::ThreadCache>;
+	using SlabAllocator = rsl::SlabAllocator<Object>;
+	using HeapAllocator = rsl::HeapAllocator<Object, MAX_OBJECTS>;
+	using StdObjectAllocator = StdAllocator<Object>;
+	using SystemObjectAllocator = SystemAllocator<Object>;
+	using ByteAllocator = rsl::ByteAllocator<unsigned char>;
+	using CachedByteAllocator = rsl::ByteAllocator<unsigned char, -1, rsl::ThreadCache>;
+	using SystemByteAllocator = SystemAllocator<unsigned char>;
+
+	// mixed request sizes, all of them inside the size classes of ThreadCache
+	constexpr rsl::size_t BLOCK_SIZES[] = {24, 64, 16, 200, 48, 512, 96, 32};
+}
+
+// takes a batch of objects and gives them back in reverse order, like a container growing and shrinking
+template<typename ALLOCATOR>
+static void AllocFree(benchmark::State& state) {
+	const auto objects = static_cast<rsl::size_t>(state.range(0));
+	ALLOCATOR allocator;
+	Object* pointers[MAX_OBJECTS];
+	for (auto _: state) {
+		for (rsl::size_t i = 0; i < objects; ++i)
+			pointers[i] = allocator.malloc();
+		benchmark::DoNotOptimize(pointers);
+		for (rsl::size_t i = objects; i > 0; --i)
+			allocator.free(pointers[i - 1]);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * objects));
+}
+
+template<typename ALLOCATOR>
+static void AllocFreeBytes(benchmark::State& state) {
+	const auto blocks = static_cast<rsl::size_t>(state.range(0));
+	constexpr rsl::size_t SIZES = sizeof(BLOCK_SIZES) / sizeof(BLOCK_SIZES[0]);
+	ALLOCATOR allocator;
+	unsigned char* pointers[MAX_OBJECTS];
+	for (auto _: state) {
+		for (rsl::size_t i = 0; i < blocks; ++i)
+			pointers[i] = allocator.malloc(BLOCK_SIZES[i % SIZES]);
+		benchmark::DoNotOptimize(pointers);
+		for (rsl::size_t i = blocks; i > 0; --i)
+			allocator.free(pointers[i - 1]);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * blocks));
+}
+
+// free does nothing for an arena, the whole batch goes back with one rewind
+static void ArenaAllocRewind(benchmark::State& state) {
+	const auto objects = static_cast<rsl::size_t>(state.range(0));
+	rsl::MonotonicArena arena(MAX_OBJECTS * sizeof(Object) * 2);
+	rsl::ArenaAllocator<Object> allocator(arena);
+	Object* pointers[MAX_OBJECTS];
+	for (auto _: state) {
+		auto marker = arena.mark();
+		for (rsl::size_t i = 0; i < objects; ++i)
+			pointers[i] = allocator.malloc();
+		benchmark::DoNotOptimize(pointers);
+		arena.rewind(marker);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * objects));
+}
+
+#define RSL_ALLOCATOR_BENCHMARK(NAME, ALLOCATOR) \
+	BENCHMARK_TEMPLATE(NAME, ALLOCATOR)->RangeMultiplier(8)->Range(8, MAX_OBJECTS)
+
+RSL_ALLOCATOR_BENCHMARK(AllocFree, ObjectAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFree, CachedObjectAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFree, SlabAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFree, HeapAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFree, StdObjectAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFree, SystemObjectAllocator);
+BENCHMARK(ArenaAllocRewind)->RangeMultiplier(8)->Range(8, MAX_OBJECTS);
+
+RSL_ALLOCATOR_BENCHMARK(AllocFreeBytes, ByteAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFreeBytes, CachedByteAllocator);
+RSL_ALLOCATOR_BENCHMARK(AllocFreeBytes, SystemByteAllocator);
+
+// every thread has its own allocator object, the cached ones still share the depot of ThreadCache
+BENCHMARK_TEMPLATE(AllocFree, CachedObjectAllocator)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(AllocFree, SystemObjectAllocator)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(AllocFreeBytes, CachedByteAllocator)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(AllocFreeBytes, SystemByteAllocator)->Arg(64)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,133 @@
+//
+// Created by robcholz on 11/15/23.
+//
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "stream/Pipeline.hpp"
+
+
+namespace {
+	constexpr rsl::size_t BLOCK_SAMPLES = 256;
+	constexpr rsl::size_t SIGNAL_MASK = 1023;
+
+	// slow ramp with deterministic noise and a spike every 97 samples, so constrain and jitter filters have work to do
+	const std::vector<int> signal = []() {
+		std::vector<int> samples(SIGNAL_MASK + 1);
+		unsigned seed = 12345;
+		for (rsl::size_t i = 0; i < samples.size(); ++i) {
+			seed = seed * 1103515245 + 12345;
+			samples[i] = static_cast<int>(i / 8) + static_cast<int>((seed >> 16) % 21) - 10 + (i % 97 == 0 ? 200 : 0);
+		}
+		return samples;
+	}();
+
+	// every filter of Pipeline::Filter, set together with its block kernel if it has one
+#define RSL_FILTER(NAME, ...) \
+	struct NAME { \
+		template<typename PIPELINE> \
+		static void set(PIPELINE& pipeline) { pipeline.filter(__VA_ARGS__); } \
+	}
+
+	RSL_FILTER(ConstrainDiff, PIPELINE::Filter::template constrainDiff<8>, PIPELINE::Filter::template constrainDiffBlock<8>);
+	RSL_FILTER(Median, PIPELINE::Filter::median, PIPELINE::Filter::medianBlock);
+	RSL_FILTER(Average, PIPELINE::Filter::average, PIPELINE::Filter::averageBlock);
+	RSL_FILTER(MedianAverage, PIPELINE::Filter::medianAverage, PIPELINE::Filter::medianAverageBlock);
+	RSL_FILTER(ConstrainedAverage, PIPELINE::Filter::template constrainedAverage<8>);
+	RSL_FILTER(IIR, PIPELINE::Filter::template IIR<50>, PIPELINE::Filter::template IIRBlock<50>);
+	RSL_FILTER(WeightedAverage, PIPELINE::Filter::weightedAverage);
+	RSL_FILTER(Jitter, PIPELINE::Filter::jitterFilter);
+	RSL_FILTER(Kalman, PIPELINE::Filter::kalmanFilter);
+
+#undef RSL_FILTER
+}
+
+// one add(), update() and output() per iteration, the way a control loop calls the pipeline
+template<typename FILTER, rsl::size_t WINDOW>
+static void FilterPerSample(benchmark::State& state) {
+	using Pipeline = rsl::Pipeline<int, float, float, WINDOW>;
+	Pipeline pipeline;
+	FILTER::set(pipeline);
+	rsl::size_t index = 0;
+	for (auto _: state) {
+		pipeline.add(signal[index++ & SIGNAL_MASK]);
+		pipeline.update();
+		benchmark::DoNotOptimize(pipeline.output());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// filters without a block kernel fall back to the per sample loop inside process()
+template<typename FILTER, rsl::size_t WINDOW>
+static void FilterPerBlock(benchmark::State& state) {
+	using Pipeline = rsl::Pipeline<int, float, float, WINDOW>;
+	Pipeline pipeline;
+	FILTER::set(pipeline);
+	float out[BLOCK_SAMPLES];
+	rsl::size_t offset = 0;
+	for (auto _: state) {
+		pipeline.process(signal.data() + offset, out, BLOCK_SAMPLES);
+		benchmark::DoNotOptimize(out);
+		offset = (offset + BLOCK_SAMPLES) & SIGNAL_MASK;
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * BLOCK_SAMPLES));
+}
+
+// baselines, the textbook std version of the average and median filters
+template<rsl::size_t WINDOW>
+static void StdAveragePerSample(benchmark::State& state) {
+	std::deque<int> window;
+	rsl::size_t index = 0;
+	for (auto _: state) {
+		if (window.size() == WINDOW)
+			window.pop_front();
+		window.push_back(signal[index++ & SIGNAL_MASK]);
+		float average = static_cast<float>(std::accumulate(window.begin(), window.end(), 0)) / static_cast<float>(window.size());
+		benchmark::DoNotOptimize(average);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+template<rsl::size_t WINDOW>
+static void StdMedianPerSample(benchmark::State& state) {
+	std::deque<int> window;
+	std::vector<int> sorted;
+	rsl::size_t index = 0;
+	for (auto _: state) {
+		if (window.size() == WINDOW)
+			window.pop_front();
+		window.push_back(signal[index++ & SIGNAL_MASK]);
+		sorted.assign(window.begin(), window.end());
+		std::nth_element(sorted.begin(), sorted.begin() + static_cast<long>(sorted.size() / 2), sorted.end());
+		benchmark::DoNotOptimize(sorted[sorted.size() / 2]);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+#define RSL_FILTER_BENCHMARK(FILTER) \
+	BENCHMARK_TEMPLATE(FilterPerSample, FILTER, 16); \
+	BENCHMARK_TEMPLATE(FilterPerSample, FILTER, 64); \
+	BENCHMARK_TEMPLATE(FilterPerSample, FILTER, 256); \
+	BENCHMARK_TEMPLATE(FilterPerBlock, FILTER, 16); \
+	BENCHMARK_TEMPLATE(FilterPerBlock, FILTER, 64); \
+	BENCHMARK_TEMPLATE(FilterPerBlock, FILTER, 256)
+
+RSL_FILTER_BENCHMARK(ConstrainDiff);
+RSL_FILTER_BENCHMARK(Median);
+RSL_FILTER_BENCHMARK(Average);
+RSL_FILTER_BENCHMARK(MedianAverage);
+RSL_FILTER_BENCHMARK(ConstrainedAverage);
+RSL_FILTER_BENCHMARK(IIR);
+RSL_FILTER_BENCHMARK(WeightedAverage);
+RSL_FILTER_BENCHMARK(Jitter);
+RSL_FILTER_BENCHMARK(Kalman);
+
+BENCHMARK_TEMPLATE(StdAveragePerSample, 16);
+BENCHMARK_TEMPLATE(StdAveragePerSample, 64);
+BENCHMARK_TEMPLATE(StdAveragePerSample, 256);
+BENCHMARK_TEMPLATE(StdMedianPerSample, 16);
+BENCHMARK_TEMPLATE(StdMedianPerSample, 64);
+BENCHMARK_TEMPLATE(StdMedianPerSample, 256);
@@ -7,11 +7,11 @@
 #define RSL_DEQUE_HPP
 
 #include <Internal.hpp>
-#include "base/DynamicArray.hpp"
+#include "base/SegmentedBuffer.hpp"
 
 
 namespace rsl {
-    template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename BASE_CONTAINER=DynamicArray<T, DEFAULT_CAPACITY>>
+    template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename BASE_CONTAINER=SegmentedBuffer<T, DEFAULT_CAPACITY>>
     class RSL_UNUSED Deque {
     public:
         Deque() = default;
@@ -19,6 +19,14 @@ namespace rsl {
         template<typename... Args>
         explicit Deque(const Args &... args);
 
+        Deque(const Deque &other) = default;
+
+        Deque(Deque &&other) noexcept = default;
+
+        Deque &operator=(const Deque &other) = default;
+
+        Deque &operator=(Deque &&other) noexcept = default;
+
         template<rsl::size_t CAPACITY_>
         explicit Deque(const Deque<T, CAPACITY_> &other);
 
@@ -45,10 +53,22 @@ namespace rsl {
 
         RSL_UNUSED void add(const T &element);
 
+        RSL_UNUSED void add(T &&element);
+
         RSL_UNUSED void addFront(const T &element);
 
+        RSL_UNUSED void addFront(T &&element);
+
         RSL_UNUSED void addBack(const T &element);
 
+        RSL_UNUSED void addBack(T &&element);
+
+        template<typename... Args>
+        RSL_UNUSED void emplaceFront(Args &&... args);
+
+        template<typename... Args>
+        RSL_UNUSED void emplaceBack(Args &&... args);
+
         RSL_UNUSED T &element() const;
 
         RSL_UNUSED T &front() const;
@@ -85,11 +105,37 @@ namespace rsl {
         BASE_CONTAINER container;
 
     public:
-	    typename BASE_CONTAINER::Iterator begin() const {
+        /**
+         * @usage get a view of the elements, nothing is copied. a Span for array based containers, a RingSpan for
+         * ring buffers
+         * @return the view, invalidated by anything that adds or removes elements
+         * @attention the base container has to provide span(), SegmentedBuffer does not
+         */
+        RSL_NODISCARD auto span() {
+            return container.span();
+        }
+
+        RSL_NODISCARD auto span() const {
+            return container.span();
+        }
+
+	    /**
+	     * @usage iterate from the front to the back, the non-const overloads let the elements be written through
+	     * @attention array base containers only have non-const iterators
+	     */
+	    auto begin() {
 			return container.begin();
 		}
 
-	    typename BASE_CONTAINER::Iterator end() const {
+	    auto end() {
+		    return container.end();
+		}
+
+	    auto begin() const {
+			return container.begin();
+		}
+
+	    auto end() const {
 		    return container.end();
 		}
     };
@@ -110,13 +156,15 @@ namespace rsl {
     template<rsl::size_t CAPACITY_>
     Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER> &Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::operator=(const Deque<T, CAPACITY_> &other) {
         container = other.container;
+        return *this;
     }
 
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     template<rsl::size_t CAPACITY_>
     Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER> &
     Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::operator=(Deque<T, CAPACITY_> &&other) noexcept {
-        container = other.container;
+        container = std::move(other.container);
+        return *this;
     }
 
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
@@ -155,16 +203,43 @@ namespace rsl {
         container.addBack(element);
     }
 
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::add(T &&element) {
+        container.addBack(std::move(element));
+    }
+
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::addFront(const T &element) {
         container.addFront(element);
     }
 
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::addFront(T &&element) {
+        container.addFront(std::move(element));
+    }
+
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::addBack(const T &element) {
         container.addBack(element);
     }
 
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::addBack(T &&element) {
+        container.addBack(std::move(element));
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename... Args>
+    void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::emplaceFront(Args &&... args) {
+        container.emplaceFront(std::forward<Args>(args)...);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename... Args>
+    void Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::emplaceBack(Args &&... args) {
+        container.emplaceBack(std::forward<Args>(args)...);
+    }
+
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     T &Deque<T, DEFAULT_CAPACITY, BASE_CONTAINER>::element() const {
         return container.front();
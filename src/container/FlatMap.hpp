@@ -0,0 +1,315 @@
+//
+// Created by robcholz on 11/18/23.
+//
+#pragma once
+
+#ifndef RSL_FLATMAP_HPP
+#define RSL_FLATMAP_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "base/DynamicArray.hpp"
+
+
+namespace rsl {
+    template<typename K, typename V>
+    struct FlatMapEntry {
+        K key;
+        V value;
+    };
+
+    /**
+     * @usage map kept as one contiguous array of entries sorted by key. lookups are a branchless binary search,
+     * iteration and range queries walk the entries in ascending key order, which makes it a good lookup table for
+     * calibration curves and thresholds
+     * @tparam K key type, ordered by operator<
+     * @tparam V value type
+     * @tparam DEFAULT_CAPACITY
+     * @tparam BASE_CONTAINER StaticArray or DynamicArray of FlatMapEntry<K, V>
+     * @attention put and remove shift the entries behind the position, prefer the batch put for many entries
+     */
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY = 10, typename BASE_CONTAINER=DynamicArray<FlatMapEntry<K, V>, DEFAULT_CAPACITY>>
+    class FlatMap {
+    public:
+        using Entry = FlatMapEntry<K, V>;
+
+        FlatMap() = default;
+
+        /**
+         * @usage set the value of key, the entry is added at its sorted position if the key is new
+         * @param key
+         * @param value
+         * @return false if the key is new and the base container is full
+         */
+        RSL_UNUSED bool put(const K &key, const V &value);
+
+        RSL_UNUSED bool put(const K &key, V &&value);
+
+        /**
+         * @usage put a batch of entries, in any order. the new keys are appended, sorted and merged with the existing
+         * ones, O(n log n) instead of one shift per entry
+         * @param first iterator over FlatMapEntry<K, V>
+         * @param last
+         * @return number of keys added, existing keys get the new value, new keys after the base container is full are
+         * dropped
+         * @attention if the batch repeats a new key one of its values is kept
+         */
+        template<typename ITERATOR>
+        RSL_UNUSED rsl::size_t put(ITERATOR first, ITERATOR last);
+
+        /**
+         * @usage value of key
+         * @param key
+         * @return nullptr if the key is not in the map
+         */
+        RSL_NODISCARD V *find(const K &key);
+
+        RSL_NODISCARD const V *find(const K &key) const;
+
+        /**
+         * @usage value of key, logs an error and returns a default value if the key is not in the map
+         * @param key
+         */
+        RSL_NODISCARD V &get(const K &key) const;
+
+        /**
+         * @usage remove key
+         * @param key
+         * @return false if the key is not in the map
+         */
+        RSL_UNUSED bool remove(const K &key);
+
+        RSL_NODISCARD bool contains(const K &key) const;
+
+        /**
+         * @usage index of the first entry whose key is not less than key, length() if there is none
+         * @param key
+         */
+        RSL_NODISCARD rsl::size_t lowerBound(const K &key) const;
+
+        /**
+         * @usage index of the first entry whose key is greater than key, length() if there is none.
+         * [lowerBound(a), upperBound(b)) are the entries with keys in [a, b]
+         * @param key
+         */
+        RSL_NODISCARD rsl::size_t upperBound(const K &key) const;
+
+        /**
+         * @usage the entry at the given index, in ascending key order. the value may be changed, the key must not
+         * @param index
+         */
+        RSL_NODISCARD Entry &entry(rsl::size_t index) const;
+
+        RSL_UNUSED void empty();
+
+        RSL_NODISCARD bool isEmpty() const;
+
+        RSL_NODISCARD rsl::size_t length() const;
+
+        RSL_NODISCARD rsl::size_t capacity() const;
+
+        /**
+         * @usage print every key and value, in key order
+         */
+        RSL_UNUSED void print() const;
+
+        Entry *begin() const;
+
+        Entry *end() const;
+
+    private:
+        BASE_CONTAINER container;
+
+        inline static Entry defaultValue{};
+
+        Entry *data() const;
+
+        static bool keyLess(const Entry &entry, const K &key) { return entry.key < key; }
+
+        static bool lessKey(const K &key, const Entry &entry) { return key < entry.key; }
+
+        static bool entryLess(const Entry &a, const Entry &b) { return a.key < b.key; }
+
+        template<typename VALUE>
+        bool putValue(const K &key, VALUE &&value);
+    };
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::put(const K &key, const V &value) {
+        return putValue(key, value);
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::put(const K &key, V &&value) {
+        return putValue(key, std::move(value));
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename ITERATOR>
+    RSL_UNUSED
+    rsl::size_t FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::put(ITERATOR first, ITERATOR last) {
+        rsl::size_t sortedLength = container.length();
+        for (; first != last; ++first) {
+            const Entry &element = *first;
+            if (sortedLength != 0) {
+                rsl::size_t index = rsl::lowerBound(data(), sortedLength, element.key, keyLess);
+                if (index < sortedLength && !(element.key < data()[index].key)) {
+                    data()[index].value = element.value;
+                    continue;
+                }
+            }
+            rsl::size_t oldLength = container.length();
+            container.addBack(element);
+            if (container.length() == oldLength)
+                break;
+        }
+        Entry *entries = data();
+        rsl::size_t length = container.length();
+        std::sort(entries + sortedLength, entries + length, entryLess);
+        // the batch itself may repeat a key
+        rsl::size_t newLength = sortedLength;
+        for (rsl::size_t index = sortedLength; index < length; ++index) {
+            if (newLength == sortedLength || entries[newLength - 1].key < entries[index].key) {
+                if (newLength != index)
+                    entries[newLength] = std::move(entries[index]);
+                ++newLength;
+            }
+        }
+        if (newLength != length)
+            container.removeRange(newLength, length - 1);
+        rsl::mergeInPlace(entries, entries + sortedLength, entries + newLength, entryLess);
+        return newLength - sortedLength;
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    V *FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::find(const K &key) {
+        rsl::size_t index = lowerBound(key);
+        if (index < container.length() && !(key < data()[index].key))
+            return &data()[index].value;
+        return nullptr;
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    const V *FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::find(const K &key) const {
+        return const_cast<FlatMap *>(this)->find(key);
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    V &FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::get(const K &key) const {
+        V *value = const_cast<FlatMap *>(this)->find(key);
+        if (value == nullptr) {
+            RSL_LOG_ERROR("Key not found");
+            return defaultValue.value;
+        }
+        return *value;
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::remove(const K &key) {
+        rsl::size_t index = lowerBound(key);
+        if (index == container.length() || key < data()[index].key)
+            return false;
+        container.remove(index);
+        return true;
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::contains(const K &key) const {
+        return find(key) != nullptr;
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::lowerBound(const K &key) const {
+        return rsl::lowerBound(data(), container.length(), key, keyLess);
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::upperBound(const K &key) const {
+        return rsl::upperBound(data(), container.length(), key, lessKey);
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    typename FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::Entry &
+    FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::entry(rsl::size_t index) const {
+        RSL_RUNTIME_BOUND_CHECK_ARG(index >= container.length(), "Out of bound", return defaultValue;);
+        return data()[index];
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    void FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::empty() {
+        container.empty();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::isEmpty() const {
+        return container.isEmpty();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::length() const {
+        return container.length();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::capacity() const {
+        return container.capacity();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    void FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::print() const {
+        RSL_PRINT("{");
+        for (const Entry &element: *this) {
+            RSL_PRINT(element.key);
+            RSL_PRINT(": ");
+            RSL_PRINT(element.value);
+            RSL_PRINT(", ");
+        }
+        RSL_PRINTF("}");
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    typename FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::Entry *FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::begin() const {
+        return data();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    typename FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::Entry *FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::end() const {
+        return data() + container.length();
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    typename FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::Entry *FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::data() const {
+        // the base containers only hand out const storage, the key order is maintained here
+        return const_cast<Entry *>(container.getRowArray());
+    }
+
+    template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename VALUE>
+    bool FlatMap<K, V, DEFAULT_CAPACITY, BASE_CONTAINER>::putValue(const K &key, VALUE &&value) {
+        rsl::size_t index = lowerBound(key);
+        if (index < container.length() && !(key < data()[index].key)) {
+            data()[index].value = std::forward<VALUE>(value);
+            return true;
+        }
+        rsl::size_t oldLength = container.length();
+        container.add(index, Entry{key, std::forward<VALUE>(value)});
+        return container.length() != oldLength;
+    }
+}
+
+#endif //RSL_FLATMAP_HPP
@@ -0,0 +1,248 @@
+//
+// Created by robcholz on 11/18/23.
+//
+#pragma once
+
+#ifndef RSL_FLATSET_HPP
+#define RSL_FLATSET_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "base/DynamicArray.hpp"
+
+
+namespace rsl {
+    /**
+     * @usage sorted set kept in one contiguous array. lookups are a branchless binary search, iteration and range
+     * queries walk the elements in ascending order
+     * @tparam T element type, ordered by operator<
+     * @tparam DEFAULT_CAPACITY
+     * @tparam BASE_CONTAINER StaticArray or DynamicArray of T
+     * @attention add and remove shift the elements behind the position, prefer the batch add for many elements
+     */
+    template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename BASE_CONTAINER=DynamicArray<T, DEFAULT_CAPACITY>>
+    class FlatSet {
+    public:
+        FlatSet() = default;
+
+        /**
+         * @usage add the element at its sorted position
+         * @param element
+         * @return false if the element is already in the set or the base container is full
+         */
+        RSL_UNUSED bool add(const T &element);
+
+        /**
+         * @usage add a batch of elements, in any order. the new elements are appended, sorted and merged with the
+         * existing ones, O(n log n) instead of one shift per element
+         * @param first
+         * @param last
+         * @return number of elements added, elements after the base container is full are dropped
+         */
+        template<typename ITERATOR>
+        RSL_UNUSED rsl::size_t add(ITERATOR first, ITERATOR last);
+
+        /**
+         * @usage remove the element
+         * @param element
+         * @return false if the element is not in the set
+         */
+        RSL_UNUSED bool remove(const T &element);
+
+        RSL_NODISCARD bool contains(const T &element) const;
+
+        /**
+         * @usage index of the element
+         * @param element
+         * @return -1 if the element is not in the set
+         */
+        RSL_NODISCARD rsl::signed_size_t indexOf(const T &element) const;
+
+        /**
+         * @usage index of the first element that is not less than element, length() if there is none
+         * @param element
+         */
+        RSL_NODISCARD rsl::size_t lowerBound(const T &element) const;
+
+        /**
+         * @usage index of the first element that is greater than element, length() if there is none.
+         * [lowerBound(a), upperBound(b)) are the elements in [a, b]
+         * @param element
+         */
+        RSL_NODISCARD rsl::size_t upperBound(const T &element) const;
+
+        /**
+         * @usage the element at the given index, in ascending order
+         * @param index
+         */
+        RSL_NODISCARD const T &get(rsl::size_t index) const;
+
+        RSL_NODISCARD const T &operator[](rsl::size_t index) const;
+
+        RSL_UNUSED void empty();
+
+        RSL_NODISCARD bool isEmpty() const;
+
+        RSL_NODISCARD rsl::size_t length() const;
+
+        RSL_NODISCARD rsl::size_t capacity() const;
+
+        RSL_UNUSED void print() const;
+
+        const T *begin() const;
+
+        const T *end() const;
+
+    private:
+        BASE_CONTAINER container;
+
+        inline static T defaultValue{};
+
+        T *data() const;
+    };
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::add(const T &element) {
+        rsl::size_t index = lowerBound(element);
+        if (index < container.length() && !(element < data()[index]))
+            return false;
+        rsl::size_t oldLength = container.length();
+        container.add(index, element);
+        return container.length() != oldLength;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename ITERATOR>
+    RSL_UNUSED
+    rsl::size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::add(ITERATOR first, ITERATOR last) {
+        auto less = [](const T &a, const T &b) { return a < b; };
+        rsl::size_t sortedLength = container.length();
+        for (; first != last; ++first) {
+            const T &element = *first;
+            if (sortedLength != 0) {
+                rsl::size_t index = rsl::lowerBound(data(), sortedLength, element, less);
+                if (index < sortedLength && !(element < data()[index]))
+                    continue;
+            }
+            rsl::size_t oldLength = container.length();
+            container.addBack(element);
+            if (container.length() == oldLength)
+                break;
+        }
+        T *elements = data();
+        rsl::size_t length = container.length();
+        std::sort(elements + sortedLength, elements + length, less);
+        // the batch itself may repeat an element
+        rsl::size_t newLength = sortedLength;
+        for (rsl::size_t index = sortedLength; index < length; ++index) {
+            if (newLength == sortedLength || elements[newLength - 1] < elements[index]) {
+                if (newLength != index)
+                    elements[newLength] = std::move(elements[index]);
+                ++newLength;
+            }
+        }
+        if (newLength != length)
+            container.removeRange(newLength, length - 1);
+        rsl::mergeInPlace(elements, elements + sortedLength, elements + newLength, less);
+        return newLength - sortedLength;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::remove(const T &element) {
+        rsl::signed_size_t index = indexOf(element);
+        if (index < 0)
+            return false;
+        container.remove(static_cast<rsl::size_t>(index));
+        return true;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::contains(const T &element) const {
+        return indexOf(element) >= 0;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::signed_size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::indexOf(const T &element) const {
+        rsl::size_t index = lowerBound(element);
+        if (index < container.length() && !(element < data()[index]))
+            return static_cast<rsl::signed_size_t>(index);
+        return -1;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::lowerBound(const T &element) const {
+        return rsl::lowerBound(data(), container.length(), element, [](const T &a, const T &b) { return a < b; });
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::upperBound(const T &element) const {
+        return rsl::upperBound(data(), container.length(), element, [](const T &a, const T &b) { return a < b; });
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    const T &FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::get(rsl::size_t index) const {
+        RSL_RUNTIME_BOUND_CHECK_ARG(index >= container.length(), "Out of bound", return defaultValue;);
+        return data()[index];
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    const T &FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::operator[](rsl::size_t index) const {
+        return get(index);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    void FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::empty() {
+        container.empty();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    bool FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::isEmpty() const {
+        return container.isEmpty();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::length() const {
+        return container.length();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    rsl::size_t FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::capacity() const {
+        return container.capacity();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    void FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::print() const {
+        container.print();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    const T *FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::begin() const {
+        return data();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    const T *FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::end() const {
+        return data() + container.length();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    T *FlatSet<T, DEFAULT_CAPACITY, BASE_CONTAINER>::data() const {
+        // the base containers only hand out const storage, the order is maintained here
+        return const_cast<T *>(container.getRowArray());
+    }
+}
+
+#endif //RSL_FLATSET_HPP
@@ -0,0 +1,194 @@
+//
+// Created by robcholz on 11/11/23.
+//
+#pragma once
+
+#ifndef RSL_MPMCQUEUE_HPP
+#define RSL_MPMCQUEUE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+    /**
+     * @usage Bounded lock-free queue for any number of producer and consumer threads. every slot carries
+     * a sequence number telling whether it is free for the producer or ready for the consumer of a given
+     * position, so threads only contend on a single compare exchange of the head or the tail
+     * @tparam T element type, needs to be default constructible and copy assignable
+     * @tparam DEFAULT_CAPACITY max number of elements, rounded up to a power of two
+     */
+    template<typename T, rsl::size_t DEFAULT_CAPACITY = 16>
+    class RSL_UNUSED MPMCQueue {
+    public:
+        MPMCQueue();
+
+        MPMCQueue(const MPMCQueue&) = delete;
+
+        MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+        /**
+         * @usage add an element, waits while the queue is full
+         * @param element
+         */
+        RSL_UNUSED void add(const T& element);
+
+        /**
+         * @usage add an element
+         * @param element
+         * @return false if the queue is full
+         */
+        RSL_UNUSED bool tryAdd(const T& element);
+
+        /**
+         * @usage take the oldest element, waits while the queue is empty
+         * @param element receives the element
+         */
+        RSL_UNUSED void pop(T& element);
+
+        /**
+         * @usage take the oldest element
+         * @param element receives the element
+         * @return false if the queue is empty
+         */
+        RSL_UNUSED bool tryPop(T& element);
+
+        /**
+         * @usage copy the oldest element without taking it
+         * @param element receives the element
+         * @return false if the queue is empty or the element was taken while copying
+         * @attention a racy snapshot. the copy may overlap a consumer taking the slot and a producer
+         * refilling it, it is only kept if the sequence shows that did not happen. T must therefore be
+         * trivially copyable, a torn copy is thrown away but never used
+         */
+        RSL_UNUSED bool front(T& element) const;
+
+        /**
+         * @attention only a snapshot while other threads are working on the queue
+         */
+        RSL_NODISCARD bool isEmpty() const;
+
+        /**
+         * @attention only a snapshot while other threads are working on the queue
+         */
+        RSL_NODISCARD rsl::size_t length() const;
+
+        RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+    private:
+        static constexpr rsl::size_t STORAGE_CAPACITY = rsl::nextPowerOfTwo(DEFAULT_CAPACITY);
+        static constexpr rsl::size_t MASK = STORAGE_CAPACITY - 1;
+
+        struct Cell {
+            // position for a free slot, position + 1 once the element is written
+            std::atomic<rsl::size_t> sequence{0};
+            T element{};
+        };
+
+        alignas(RSL_CACHE_LINE_SIZE) std::atomic<rsl::size_t> tail{0}; // next position to add to
+        alignas(RSL_CACHE_LINE_SIZE) std::atomic<rsl::size_t> head{0}; // next position to pop from
+        alignas(RSL_CACHE_LINE_SIZE) Cell cells[STORAGE_CAPACITY];
+    };
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    MPMCQueue<T, DEFAULT_CAPACITY>::MPMCQueue() {
+        RSL_COMPILETIME_BOUND_CHECK(DEFAULT_CAPACITY > 1, "Capacity must be larger than 1.");
+        for (rsl::size_t index = 0; index < STORAGE_CAPACITY; ++index)
+            cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    void MPMCQueue<T, DEFAULT_CAPACITY>::add(const T& element) {
+        while (!tryAdd(element))
+            std::this_thread::yield();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    bool MPMCQueue<T, DEFAULT_CAPACITY>::tryAdd(const T& element) {
+        rsl::size_t position = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[position & MASK];
+            rsl::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<rsl::signed_size_t>(sequence - position);
+            if (difference == 0) {
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.element = element;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // the slot still holds the element of the previous lap
+            } else {
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    void MPMCQueue<T, DEFAULT_CAPACITY>::pop(T& element) {
+        while (!tryPop(element))
+            std::this_thread::yield();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    bool MPMCQueue<T, DEFAULT_CAPACITY>::tryPop(T& element) {
+        rsl::size_t position = head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[position & MASK];
+            rsl::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<rsl::signed_size_t>(sequence - (position + 1));
+            if (difference == 0) {
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    element = cell.element;
+                    cell.sequence.store(position + STORAGE_CAPACITY, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // nothing written to this slot yet
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    bool MPMCQueue<T, DEFAULT_CAPACITY>::front(T& element) const {
+        // not a bound check, it has to hold with checks disabled as well
+        static_assert(std::is_trivially_copyable<T>::value, "front() copies racily, T must be trivially copyable.");
+        rsl::size_t position = head.load(std::memory_order_acquire);
+        const Cell& cell = cells[position & MASK];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+            return false;
+        element = cell.element;
+        // the copy is only valid if nobody popped the slot meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return (cell.sequence.load(std::memory_order_relaxed) == position + 1);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    bool MPMCQueue<T, DEFAULT_CAPACITY>::isEmpty() const {
+        return (length() == 0);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    rsl::size_t MPMCQueue<T, DEFAULT_CAPACITY>::length() const {
+        rsl::size_t currentHead = head.load(std::memory_order_acquire);
+        // tail is read last and never falls behind head
+        return tail.load(std::memory_order_acquire) - currentHead;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    constexpr rsl::size_t MPMCQueue<T, DEFAULT_CAPACITY>::capacity() const {
+        return STORAGE_CAPACITY;
+    }
+}
+
+#endif //RSL_MPMCQUEUE_HPP
@@ -0,0 +1,279 @@
+//
+// Created by robcholz on 11/22/23.
+//
+#pragma once
+
+#ifndef RSL_PRIORITYQUEUE_HPP
+#define RSL_PRIORITYQUEUE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "base/DynamicArray.hpp"
+
+
+namespace rsl {
+    /**
+     * @usage d-ary heap over an array, add and pop are O(log n) and top is O(1). a wider heap is shallower and reads
+     * the children of a node from one or two cache lines, which usually beats the binary layout for small elements
+     * @tparam T element type
+     * @tparam DEFAULT_CAPACITY
+     * @tparam BASE_CONTAINER StaticArray or DynamicArray of T
+     * @tparam COMPARE COMPARE(a, b) is true if a has a lower priority than b, std::less puts the largest element on top
+     * @tparam ARITY children per node, 2 for a binary heap, 4 is often faster for small elements
+     */
+    template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename BASE_CONTAINER=DynamicArray<T, DEFAULT_CAPACITY>,
+            typename COMPARE=std::less<T>, rsl::size_t ARITY = 2>
+    class RSL_UNUSED PriorityQueue {
+    public:
+        PriorityQueue() = default;
+
+        /**
+         * @usage build the heap from a range in O(n)
+         * @param first
+         * @param last
+         */
+        template<typename ITERATOR>
+        PriorityQueue(ITERATOR first, ITERATOR last);
+
+        /**
+         * @usage add an element
+         * @param element
+         * @attention operation will be ignored if the base container is full
+         */
+        RSL_UNUSED void add(const T &element);
+
+        RSL_UNUSED void add(T &&element);
+
+        /**
+         * @usage add every element of a range. if the range is at least as long as the queue the heap is rebuilt in
+         * O(n), otherwise the elements are sifted up one by one
+         * @param first
+         * @param last
+         * @attention elements after the base container is full are dropped
+         */
+        template<typename ITERATOR>
+        RSL_UNUSED void add(ITERATOR first, ITERATOR last);
+
+        template<typename... Args>
+        RSL_UNUSED void emplace(Args &&... args);
+
+        /**
+         * @usage remove the top element
+         */
+        RSL_UNUSED void pop();
+
+        /**
+         * @usage replace the top element and restore the heap with one sift down, cheaper than pop followed by add.
+         * keeps the k smallest elements seen when used with std::less and k elements in the queue
+         * @param element
+         */
+        RSL_UNUSED void replaceTop(const T &element);
+
+        RSL_UNUSED void replaceTop(T &&element);
+
+        /**
+         * @usage the element with the highest priority
+         * @return the top element, the default value of T if the queue is empty
+         */
+        RSL_NODISCARD const T &top() const;
+
+        RSL_UNUSED void empty();
+
+        RSL_NODISCARD bool isEmpty() const;
+
+        RSL_NODISCARD rsl::size_t length() const;
+
+        RSL_NODISCARD rsl::size_t capacity() const;
+
+        /**
+         * @usage print the elements in heap order
+         */
+        RSL_UNUSED void print() const;
+
+    private:
+        BASE_CONTAINER container;
+        COMPARE compare;
+
+        inline static T defaultValue{};
+
+        RSL_COMPILETIME_BOUND_CHECK(ARITY >= 2, "Arity must be at least 2.");
+
+        T *data() const;
+
+        void siftUp(rsl::size_t index);
+
+        void siftDown(rsl::size_t index);
+
+        void heapify();
+    };
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    template<typename ITERATOR>
+    PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::PriorityQueue(ITERATOR first, ITERATOR last) {
+        add(first, last);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::add(const T &element) {
+        emplace(element);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::add(T &&element) {
+        emplace(std::move(element));
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    template<typename ITERATOR>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::add(ITERATOR first, ITERATOR last) {
+        rsl::size_t oldLength = container.length();
+        for (; first != last; ++first) {
+            rsl::size_t length = container.length();
+            container.addBack(*first);
+            if (container.length() == length)
+                break;
+        }
+        rsl::size_t count = container.length() - oldLength;
+        if (count >= oldLength) {
+            heapify();
+        } else {
+            for (rsl::size_t index = oldLength; index < container.length(); ++index)
+                siftUp(index);
+        }
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    template<typename... Args>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::emplace(Args &&... args) {
+        rsl::size_t length = container.length();
+        container.emplaceBack(std::forward<Args>(args)...);
+        if (container.length() != length)
+            siftUp(length);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::pop() {
+        RSL_RUNTIME_BOUND_CHECK_ARG(container.isEmpty(), "Priority queue is empty, pop failed", return;);
+        rsl::size_t last = container.length() - 1;
+        if (last != 0)
+            data()[0] = std::move(data()[last]);
+        container.popBack();
+        if (last > 1)
+            siftDown(0);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::replaceTop(const T &element) {
+        replaceTop(T(element));
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::replaceTop(T &&element) {
+        if (container.isEmpty()) {
+            add(std::move(element));
+            return;
+        }
+        data()[0] = std::move(element);
+        siftDown(0);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    const T &PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::top() const {
+        RSL_RUNTIME_BOUND_CHECK_ARG(container.isEmpty(), "Priority queue is empty", return defaultValue;);
+        return data()[0];
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::empty() {
+        container.empty();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    bool PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::isEmpty() const {
+        return container.isEmpty();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    rsl::size_t PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::length() const {
+        return container.length();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    rsl::size_t PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::capacity() const {
+        return container.capacity();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    RSL_UNUSED
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::print() const {
+        container.print();
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    T *PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::data() const {
+        // the base containers only hand out const storage, the heap order is maintained here
+        return const_cast<T *>(container.getRowArray());
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::siftUp(rsl::size_t index) {
+        // move a hole up instead of swapping, every step is one move
+        T *elements = data();
+        T element = std::move(elements[index]);
+        while (index > 0) {
+            rsl::size_t parent = (index - 1) / ARITY;
+            if (!compare(elements[parent], element))
+                break;
+            elements[index] = std::move(elements[parent]);
+            index = parent;
+        }
+        elements[index] = std::move(element);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::siftDown(rsl::size_t index) {
+        T *elements = data();
+        rsl::size_t length = container.length();
+        T element = std::move(elements[index]);
+        while (true) {
+            rsl::size_t firstChild = index * ARITY + 1;
+            if (firstChild >= length)
+                break;
+            rsl::size_t lastChild = rsl::min(firstChild + ARITY, length);
+            rsl::size_t best = firstChild;
+            for (rsl::size_t child = firstChild + 1; child < lastChild; ++child) {
+                if (compare(elements[best], elements[child]))
+                    best = child;
+            }
+            if (!compare(element, elements[best]))
+                break;
+            elements[index] = std::move(elements[best]);
+            index = best;
+        }
+        elements[index] = std::move(element);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER, typename COMPARE, rsl::size_t ARITY>
+    void PriorityQueue<T, DEFAULT_CAPACITY, BASE_CONTAINER, COMPARE, ARITY>::heapify() {
+        // Floyd's construction, sift down every parent from the last one up
+        rsl::size_t length = container.length();
+        if (length < 2)
+            return;
+        for (rsl::size_t index = (length - 2) / ARITY + 1; index > 0; --index)
+            siftDown(index - 1);
+    }
+}
+
+#endif //RSL_PRIORITYQUEUE_HPP
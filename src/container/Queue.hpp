@@ -18,10 +18,19 @@ namespace rsl {
 
         RSL_UNUSED void add(const T &element);
 
+        RSL_UNUSED void add(T &&element);
+
+        template<typename... Args>
+        RSL_UNUSED void emplace(Args &&... args);
+
         RSL_UNUSED void pop();
 
+        /**
+         * @usage exchange the elements with other, the storage is exchanged if both use the same base container
+         * @param other
+         */
         template<rsl::size_t CAPACITY_, typename BASE_CONTAINER_>
-        RSL_UNUSED void swap(const Queue<T, CAPACITY_, BASE_CONTAINER_> &other);
+        RSL_UNUSED void swap(Queue<T, CAPACITY_, BASE_CONTAINER_> &other);
 
         RSL_UNUSED T &element() const;
 
@@ -35,6 +44,9 @@ namespace rsl {
 
     private:
         BASE_CONTAINER container;
+
+        template<typename, rsl::size_t, typename>
+        friend class Queue;
     };
 
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
@@ -43,6 +55,19 @@ namespace rsl {
         container.addFront(element);
     }
 
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    RSL_UNUSED
+    void Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::add(T &&element) {
+        container.addFront(std::move(element));
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
+    template<typename... Args>
+    RSL_UNUSED
+    void Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::emplace(Args &&... args) {
+        container.emplaceFront(std::forward<Args>(args)...);
+    }
+
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     RSL_UNUSED
     void Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::pop() {
@@ -52,22 +77,27 @@ namespace rsl {
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     template<rsl::size_t CAPACITY_, typename BASE_CONTAINER_>
     RSL_UNUSED
-    void Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::swap(const Queue<T, CAPACITY_, BASE_CONTAINER_> &other) {
-        static rsl::size_t thisLength;
-        static rsl::size_t index;
-        thisLength = container.length();
-        container.addBack(other);
-        other.empty();
-        for (index = 0; index < thisLength; ++index) {
-            other.addFront(container.front());
-            container.popFront();
+    void Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::swap(Queue<T, CAPACITY_, BASE_CONTAINER_> &other) {
+        if (reinterpret_cast<const void *>(this) == reinterpret_cast<const void *>(&other))
+            return;
+        BASE_CONTAINER temp(std::move(container));
+        if constexpr (std::is_same<BASE_CONTAINER, BASE_CONTAINER_>::value) {
+            container = std::move(other.container);
+            other.container = std::move(temp);
+        } else {
+            container.empty();
+            for (auto &element: other.container)
+                container.addBack(std::move(element));
+            other.container.empty();
+            for (auto &element: temp)
+                other.container.addBack(std::move(element));
         }
     }
 
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
     RSL_UNUSED
     T &Queue<T, DEFAULT_CAPACITY, BASE_CONTAINER>::element() const {
-        container.front();
+        return container.front();
     }
 
     template<typename T, rsl::size_t DEFAULT_CAPACITY, typename BASE_CONTAINER>
@@ -0,0 +1,168 @@
+//
+// Created by robcholz on 11/10/23.
+//
+#pragma once
+
+#ifndef RSL_SPSCQUEUE_HPP
+#define RSL_SPSCQUEUE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+    /**
+     * @usage Bounded lock-free queue for exactly one producer thread and one consumer thread.
+     * elements are stored inline like StaticArray, head and tail live on their own cache lines
+     * @tparam T element type, needs to be default constructible and copy assignable
+     * @tparam DEFAULT_CAPACITY max number of elements
+     * @attention push and pushN may only be called from the producer, pop and popN only from the consumer
+     */
+    template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
+    class RSL_UNUSED SPSCQueue {
+    public:
+        SPSCQueue() = default;
+
+        SPSCQueue(const SPSCQueue&) = delete;
+
+        SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+        /**
+         * @usage add an element, producer only
+         * @param element
+         * @return false if the queue is full
+         */
+        RSL_UNUSED bool push(const T& element);
+
+        /**
+         * @usage take the oldest element, consumer only
+         * @param element receives the element
+         * @return false if the queue is empty
+         */
+        RSL_UNUSED bool pop(T& element);
+
+        /**
+         * @usage add up to length elements with a single publish, producer only
+         * @param elements
+         * @param length
+         * @return number of elements added
+         */
+        RSL_UNUSED rsl::size_t pushN(const T* elements, rsl::size_t length);
+
+        /**
+         * @usage take up to length of the oldest elements with a single release, consumer only
+         * @param elements receives the elements
+         * @param length
+         * @return number of elements taken
+         */
+        RSL_UNUSED rsl::size_t popN(T* elements, rsl::size_t length);
+
+        /**
+         * @attention only exact when called from the producer or the consumer while the other side is idle
+         */
+        RSL_NODISCARD bool isEmpty() const;
+
+        /**
+         * @attention only exact when called from the producer or the consumer while the other side is idle
+         */
+        RSL_NODISCARD rsl::size_t length() const;
+
+        RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+    private:
+        static constexpr rsl::size_t STORAGE_CAPACITY = rsl::nextPowerOfTwo(DEFAULT_CAPACITY);
+        static constexpr rsl::size_t MASK = STORAGE_CAPACITY - 1;
+
+        // head and tail only grow, the slot is the counter masked
+        alignas(RSL_CACHE_LINE_SIZE) std::atomic<rsl::size_t> head{0}; // written by the consumer
+        rsl::size_t cachedTail{0}; // consumer's last view of tail
+        alignas(RSL_CACHE_LINE_SIZE) std::atomic<rsl::size_t> tail{0}; // written by the producer
+        rsl::size_t cachedHead{0}; // producer's last view of head
+        alignas(RSL_CACHE_LINE_SIZE) T container[STORAGE_CAPACITY]{};
+
+        rsl::size_t freeSlots(rsl::size_t currentTail, rsl::size_t wanted);
+
+        rsl::size_t usedSlots(rsl::size_t currentHead, rsl::size_t wanted);
+    };
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    bool SPSCQueue<T, DEFAULT_CAPACITY>::push(const T& element) {
+        rsl::size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (freeSlots(currentTail, 1) == 0)
+            return false;
+        container[currentTail & MASK] = element;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    bool SPSCQueue<T, DEFAULT_CAPACITY>::pop(T& element) {
+        rsl::size_t currentHead = head.load(std::memory_order_relaxed);
+        if (usedSlots(currentHead, 1) == 0)
+            return false;
+        element = container[currentHead & MASK];
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::pushN(const T* elements, rsl::size_t length) {
+        rsl::size_t currentTail = tail.load(std::memory_order_relaxed);
+        rsl::size_t count = freeSlots(currentTail, length);
+        for (rsl::size_t index = 0; index < count; ++index)
+            container[(currentTail + index) & MASK] = elements[index];
+        tail.store(currentTail + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_UNUSED
+    rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::popN(T* elements, rsl::size_t length) {
+        rsl::size_t currentHead = head.load(std::memory_order_relaxed);
+        rsl::size_t count = usedSlots(currentHead, length);
+        for (rsl::size_t index = 0; index < count; ++index)
+            elements[index] = container[(currentHead + index) & MASK];
+        head.store(currentHead + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    bool SPSCQueue<T, DEFAULT_CAPACITY>::isEmpty() const {
+        return (length() == 0);
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::length() const {
+        rsl::size_t currentHead = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - currentHead;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    RSL_NODISCARD
+    constexpr rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::capacity() const {
+        return DEFAULT_CAPACITY;
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::freeSlots(rsl::size_t currentTail, rsl::size_t wanted) {
+        RSL_COMPILETIME_BOUND_CHECK(DEFAULT_CAPACITY > 0, "Capacity must be larger than 0.");
+        // only reload head (and take its cache line) when the cached view says there is not enough room
+        if (DEFAULT_CAPACITY - (currentTail - cachedHead) < wanted)
+            cachedHead = head.load(std::memory_order_acquire);
+        return rsl::min(wanted, DEFAULT_CAPACITY - (currentTail - cachedHead));
+    }
+
+    template<typename T, rsl::size_t DEFAULT_CAPACITY>
+    rsl::size_t SPSCQueue<T, DEFAULT_CAPACITY>::usedSlots(rsl::size_t currentHead, rsl::size_t wanted) {
+        if (cachedTail - currentHead < wanted)
+            cachedTail = tail.load(std::memory_order_acquire);
+        return rsl::min(wanted, cachedTail - currentHead);
+    }
+}
+
+#endif //RSL_SPSCQUEUE_HPP
@@ -8,6 +8,8 @@
 
 #include <Internal.hpp>
 #include <memory/ByteAllocator.hpp>
+#include <utils/Utils.hpp>
+#include "Span.hpp"
 
 
 namespace rsl {
@@ -15,6 +17,8 @@ namespace rsl {
 	 * @usage A heap-allocated, dynamic-size array
 	 * @tparam T element type
 	 * @tparam DEFAULT_CAPACITY default array capacity
+	 * @tparam ALLOCATOR byte allocator, if it has tryExpand(ptr, bytes) trivially copyable elements are grown in place
+	 * @attention like StaticArray every slot up to the capacity holds a constructed T, so T needs to be default constructible
  	 */
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename ALLOCATOR=ByteAllocator<T>>
 	class RSL_UNUSED DynamicArray {
@@ -41,6 +45,25 @@ namespace rsl {
 		template<rsl::size_t CAPACITY_>
 		explicit DynamicArray(const DynamicArray<T, CAPACITY_>& other);
 
+		DynamicArray(const DynamicArray& other);
+
+		/**
+		 * @usage take over the storage of other together with its allocator, no element is copied or moved. if the
+		 * allocator cannot be moved the elements are moved one by one
+		 * @param other instance, left empty
+		 */
+		DynamicArray(DynamicArray&& other) noexcept;
+
+		DynamicArray& operator=(const DynamicArray& other);
+
+		/**
+		 * @usage release the own storage and take over the storage of other together with its allocator, if the
+		 * allocator cannot be moved the elements are moved one by one
+		 * @param other instance, left empty
+		 * @return this instance
+		 */
+		DynamicArray& operator=(DynamicArray&& other) noexcept;
+
 		/**
 		 * @usage copy constructor
 		 * @param other instance
@@ -51,10 +74,9 @@ namespace rsl {
 		DynamicArray& operator=(const DynamicArray<T, CAPACITY_>& other);
 
 		/**
-		 * @usage move constructor
-		 * @param other instance
+		 * @usage move assignment from an array of another capacity, the elements are moved one by one
+		 * @param other instance, left empty
 		 * @return new instance
-		 * @attention if the length of the copied array is larger than the capacity of the array copied to, the array will be filled
 		 */
 		template<rsl::size_t CAPACITY_>
 		DynamicArray& operator=(DynamicArray<T, CAPACITY_>&& other) noexcept;
@@ -104,6 +126,8 @@ namespace rsl {
 
 		RSL_UNUSED void addFront(const T& element);
 
+		RSL_UNUSED void addFront(T&& element);
+
 		/**
 		 * @usage addBack an element to the end of the array
 		 * @param element
@@ -111,6 +135,8 @@ namespace rsl {
 		 */
 		RSL_UNUSED void addBack(const T& element);
 
+		RSL_UNUSED void addBack(T&& element);
+
 		/**
 		 * @usage addBack the element at the given index of the array
 		 * @param index
@@ -119,6 +145,30 @@ namespace rsl {
 		 */
 		RSL_UNUSED void add(rsl::size_t index, const T& element);
 
+		RSL_UNUSED void add(rsl::size_t index, T&& element);
+
+		/**
+		 * @usage construct an element at the front of the array
+		 * @param args arguments forwarded to the constructor of T
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element at the end of the array, in place unless the array has to grow
+		 * @param args arguments forwarded to the constructor of T
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
+		/**
+		 * @usage construct an element at the given index of the array
+		 * @param index
+		 * @param args arguments forwarded to the constructor of T
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplace(rsl::size_t index, Args&& ... args);
+
 		/**
  		 * @usage append another array to the end of the array
  		 * @param array
@@ -135,6 +185,24 @@ namespace rsl {
 		template<rsl::size_t CAPACITY_>
 		RSL_UNUSED void appendBack(const DynamicArray<T, CAPACITY_>& array);
 
+		/**
+		 * @usage append the elements of a view to the end of the array, e.g. the span of an array of another type
+		 * @tparam U T or const T
+		 * @param span
+		 * @attention operation will be ignored if array is full
+		 */
+		template<typename U>
+		RSL_UNUSED void appendBack(const Span<U>& span);
+
+		/**
+		 * @usage append the elements of a ring view, e.g. the window of a pipeline, to the end of the array
+		 * @tparam U T or const T
+		 * @param span
+		 * @attention operation will be ignored if array is full, the view must not point into this array
+		 */
+		template<typename U>
+		RSL_UNUSED void appendBack(const RingSpan<U>& span);
+
 		/**
 		 * @usage append another array at the given index of the array
 		 * @param index
@@ -144,6 +212,18 @@ namespace rsl {
 		template<rsl::size_t CAPACITY_>
 		RSL_UNUSED void append(rsl::size_t index, const DynamicArray<T, CAPACITY_>& array);
 
+		/**
+		 * @usage insert the elements of [first, last) at the given index, the array grows at most once and its tail
+		 * is shifted only once
+		 * @tparam ITERATOR iterator whose elements are assignable to T
+		 * @param index
+		 * @param first
+		 * @param last
+		 * @attention the range must not point into this array, growing may move the storage
+		 */
+		template<typename ITERATOR>
+		RSL_UNUSED void insert(rsl::size_t index, ITERATOR first, ITERATOR last);
+
 		RSL_UNUSED T& front() const;
 
 		RSL_UNUSED T& back() const;
@@ -188,8 +268,15 @@ namespace rsl {
 		 */
 		RSL_UNUSED void empty();
 
+		/**
+		 * @usage shrink the capacity to the length of the array, in place when the allocator allows it
+		 */
 		RSL_UNUSED void trimToSize();
 
+		/**
+		 * @usage reserve room for at least capacity elements, does nothing if the array is large enough already
+		 * @param capacity
+		 */
 		RSL_UNUSED void capacity(rsl::size_t capacity);
 
 		/**
@@ -251,6 +338,14 @@ namespace rsl {
 		 */
 		RSL_UNUSED const T* getRowArray() const;
 
+		/**
+		 * @usage get a view of the elements, nothing is copied
+		 * @return the view, invalidated by anything that adds or removes elements
+		 */
+		RSL_NODISCARD Span<T> span();
+
+		RSL_NODISCARD Span<const T> span() const;
+
 		/**
 		 * @usage print the array
 		 */
@@ -260,9 +355,12 @@ namespace rsl {
 		T* container{nullptr}; // row array
 		rsl::size_t containerLength{0}; // the current length of the array
 		rsl::size_t containerCapacity{0};
-		inline static T defaultValue{0};
+		inline static T defaultValue{};
 		ALLOCATOR allocator;
 
+		// spare slots of such types need no construction and the storage can be copied bytewise
+		static constexpr bool TRIVIAL = std::is_trivially_copyable<T>::value && std::is_trivially_default_constructible<T>::value;
+
 		class RSL_UNUSED Iterator {
 		private:
 			T* containerPtr;
@@ -298,9 +396,8 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator++(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator++(int) {
+				Iterator temp = *this;
 				++(*this);
 				return temp;
 			}
@@ -310,20 +407,27 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator--(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator--(int) {
+				Iterator temp = *this;
 				--(*this);
 				return temp;
 			}
 		};
 
+		DynamicArray(DynamicArray&& other, std::true_type);
+
+		DynamicArray(DynamicArray&& other, std::false_type);
+
 		template<typename Arg, typename... Args>
 		void addVariadic(const Arg& arg, const Args& ... args);
 
 		void addVariadic();
 
-		void ensureCapacity(rsl::size_t minCapacity);
+		bool ensureCapacity(rsl::size_t minCapacity);
+
+		bool reallocate(rsl::size_t capacity);
+
+		void release();
 
 	public:
 		/**
@@ -357,17 +461,9 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicArray(const DynamicArray<T, CAPACITY_>& other) {
-		static rsl::size_t otherLength;
-		static const T* otherContainer;
-		static rsl::size_t i;
-
-		otherLength = other.length();
-		otherContainer = other.getRowArray();
 		capacity(other.capacity());
-		this->containerLength = otherLength;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
-		}
+		rsl::copyRange(container, other.getRowArray(), other.length());
+		containerLength = other.length();
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
@@ -375,20 +471,12 @@ namespace rsl {
 	RSL_UNUSED
 	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(const DynamicArray<T, CAPACITY_>& other) {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
-
-		static rsl::size_t otherLength;
-		static const T* otherContainer;
-		static rsl::size_t i;
-
-		otherLength = other.length();
-		otherContainer = other.getRowArray();
+		containerLength = 0; // old elements are overwritten, no need to carry them into a new block
 		capacity(other.capacity());
-		this->containerLength = otherLength;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
-		}
+		rsl::copyRange(container, other.getRowArray(), other.length());
+		containerLength = other.length();
 		return *this;
 	}
 
@@ -397,19 +485,80 @@ namespace rsl {
 	RSL_UNUSED
 	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(DynamicArray<T, CAPACITY_>&& other) noexcept {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
+		containerLength = 0; // old elements are overwritten, no need to carry them into a new block
+		capacity(other.length());
+		for (rsl::size_t index = 0; index < other.length(); ++index)
+			container[index] = std::move(other.get(index));
+		containerLength = other.length();
+		other.empty();
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicArray(const DynamicArray& other) : allocator(other.allocator) {
+		capacity(other.containerCapacity);
+		for (rsl::size_t index = 0; index < other.containerLength; ++index)
+			container[index] = other.container[index];
+		containerLength = other.containerLength;
+	}
 
-		static rsl::size_t otherLength;
-		static const T* otherContainer;
-		static rsl::size_t i;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicArray(DynamicArray&& other) noexcept
+			: DynamicArray(std::move(other), typename std::is_move_constructible<ALLOCATOR>::type{}) {}
 
-		otherLength = other.length();
-		otherContainer = other.getRowArray();
-		capacity(other.capacity());
-		this->containerLength = otherLength;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicArray(DynamicArray&& other, std::true_type)
+			: container(other.container), containerLength(other.containerLength), containerCapacity(other.containerCapacity),
+			  allocator(std::move(other.allocator)) {
+		other.container = nullptr;
+		other.containerLength = 0;
+		other.containerCapacity = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicArray(DynamicArray&& other, std::false_type) {
+		// the storage may live inside the allocator of other, e.g. InlineAllocator
+		capacity(rsl::max(DEFAULT_CAPACITY, other.containerLength));
+		for (rsl::size_t index = 0; index < other.containerLength; ++index)
+			container[index] = std::move(other.container[index]);
+		containerLength = other.containerLength;
+		other.containerLength = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(const DynamicArray& other) {
+		if (this == &other)
+			return *this;
+		containerLength = 0;
+		capacity(other.containerLength);
+		for (rsl::size_t index = 0; index < other.containerLength; ++index)
+			container[index] = other.container[index];
+		containerLength = other.containerLength;
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(DynamicArray&& other) noexcept {
+		if (this == &other)
+			return *this;
+		if constexpr (std::is_move_assignable<ALLOCATOR>::value) {
+			release();
+			container = other.container;
+			containerLength = other.containerLength;
+			containerCapacity = other.containerCapacity;
+			allocator = std::move(other.allocator);
+			other.container = nullptr;
+			other.containerLength = 0;
+			other.containerCapacity = 0;
+		} else {
+			containerLength = 0;
+			capacity(other.containerLength);
+			for (rsl::size_t index = 0; index < other.containerLength; ++index)
+				container[index] = std::move(other.container[index]);
+			containerLength = other.containerLength;
+			other.containerLength = 0;
 		}
 		return *this;
 	}
@@ -418,13 +567,10 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::operator==(const DynamicArray<T, CAPACITY_>& other) const {
-		static const T* otherContainer;
-		static rsl::size_t i;
-
-		otherContainer = other.getRowArray();
+		const T* otherContainer = other.getRowArray();
 		if (this->containerLength != other.length())
 			return false;
-		for (i = 0; i < this->containerLength; ++i) {
+		for (rsl::size_t i = 0; i < this->containerLength; ++i) {
 			if (this->container[i] != otherContainer[i])
 				return false;
 		}
@@ -460,7 +606,7 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::~DynamicArray() {
-		allocator.free(container);
+		release();
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
@@ -469,23 +615,70 @@ namespace rsl {
 		add(0, element);
 	}
 
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::addFront(T&& element) {
+		emplace(0, std::move(element));
+	}
+
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(const T& element) {
-		ensureCapacity(containerCapacity + 1);
-		container[containerLength] = element;
-		++containerLength;
+		emplaceBack(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(T&& element) {
+		emplaceBack(std::move(element));
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::add(rsl::size_t index, const T& element) {
-		ensureCapacity(containerCapacity + 1);
-		static rsl::size_t i;
-		for (i = containerLength; i > index; --i) {
-			container[i] = container[i - 1];
+		emplace(index, element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::add(rsl::size_t index, T&& element) {
+		emplace(index, std::move(element));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceFront(Args&& ... args) {
+		emplace(0, std::forward<Args>(args)...);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceBack(Args&& ... args) {
+		if (containerLength < containerCapacity) {
+			rsl::reconstruct(container[containerLength], std::forward<Args>(args)...);
+		} else {
+			// built before growing, args may refer to an element of the old storage
+			T element(std::forward<Args>(args)...);
+			if (!ensureCapacity(containerLength + 1))
+				return;
+			container[containerLength] = std::move(element);
 		}
-		container[index] = element;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::emplace(rsl::size_t index, Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index > containerLength, "Index out of bound", return;);
+		// built before shifting, args may refer to an element of the array
+		T element(std::forward<Args>(args)...);
+		if (!ensureCapacity(containerLength + 1))
+			return;
+		rsl::moveRange(container + index + 1, container + index, containerLength - index);
+		container[index] = std::move(element);
 		++containerLength;
 	}
 
@@ -500,31 +693,58 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::appendBack(const DynamicArray<T, CAPACITY_>& array) {
-		static rsl::size_t arrayLength = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		static rsl::size_t i;
-		ensureCapacity(containerCapacity + arrayLength);
-		for (i = 0; i < arrayLength; ++i) {
-			container[containerLength + i] = arrayContainer[i];
-		}
+		rsl::size_t arrayLength = array.length();
+		if (!ensureCapacity(containerLength + arrayLength))
+			return;
+		// read the source after growing, it may be this array
+		rsl::copyRange(container + containerLength, array.getRowArray(), arrayLength);
 		containerLength += arrayLength;
 	}
 
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename U>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::appendBack(const Span<U>& span) {
+		rsl::size_t spanLength = span.length();
+		// a span of this array moves with it when the array grows
+		bool ownElements = !std::less<const T*>()(span.data(), container) &&
+		                   std::less<const T*>()(span.data(), container + containerLength);
+		rsl::size_t offset = ownElements ? static_cast<rsl::size_t>(span.data() - container) : 0;
+		if (!ensureCapacity(containerLength + spanLength))
+			return;
+		const T* source = ownElements ? container + offset : span.data();
+		rsl::copyRange(container + containerLength, source, spanLength);
+		containerLength += spanLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename U>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::appendBack(const RingSpan<U>& span) {
+		if (!ensureCapacity(containerLength + span.length()))
+			return;
+		span.copyTo(container + containerLength);
+		containerLength += span.length();
+	}
+
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::append(rsl::size_t index, const DynamicArray<T, CAPACITY_>& array) {
-		static rsl::size_t arrayLength = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		static rsl::size_t i;
-		ensureCapacity(containerCapacity + arrayLength);
-		for (i = index; i < containerLength; ++i) {
-			container[i + containerLength - 1] = container[i];
-		} // move the elements
-		for (i = 0; i < arrayLength; ++i) {
-			container[index + i] = arrayContainer[i];
-		} // add the elements
-		containerLength += arrayLength;
+		insert(index, array.getRowArray(), array.getRowArray() + array.length());
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename ITERATOR>
+	RSL_UNUSED
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::insert(rsl::size_t index, ITERATOR first, ITERATOR last) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index > containerLength, "Index out of bound", return;);
+		rsl::size_t count = rsl::distance(first, last);
+		if (!ensureCapacity(containerLength + count))
+			return;
+		rsl::moveRange(container + index + count, container + index, containerLength - index);
+		rsl::copyRange(container + index, first, count);
+		containerLength += count;
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
@@ -556,11 +776,8 @@ namespace rsl {
 	RSL_UNUSED
 	T DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::remove(rsl::size_t index) {
 		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Out of capacity, remove failed", return defaultValue;);
-		static T temp = container[index];
-		static rsl::size_t i;
-		for (i = index; i < containerLength - 1; ++i) {
-			container[i] = container[i + 1];
-		}
+		T temp = std::move(container[index]);
+		rsl::moveRange(container + index, container + index + 1, containerLength - index - 1);
 		--containerLength;
 		return temp;
 	}
@@ -568,13 +785,10 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::searchRemove(const T& element) {
-		static rsl::signed_size_t index;
-		index = indexOf(element);
+		rsl::signed_size_t index = indexOf(element);
 		if (index == -1)
 			return false;
-		for (; index < containerLength - 1; ++index) {
-			container[index] = container[index + 1];
-		}
+		rsl::moveRange(container + index, container + index + 1, containerLength - index - 1);
 		--containerLength;
 		return true;
 	}
@@ -583,29 +797,25 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::removeAll(const DynamicArray<T, CAPACITY_>& array) {
-		static bool flag = false;
-		static rsl::size_t arrayLength = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		static rsl::size_t i, k;
-		for (i = 0; i < arrayLength; ++i) {
-			for (k = 0; k < this->containerLength; ++k) {
-				if (arrayContainer[i] == this->container[k]) {
-					this->remove(k);
-					flag = true;
-				}
-			}
+		// compact the kept elements in a single pass instead of shifting the tail once per removal
+		rsl::size_t kept = 0;
+		for (rsl::size_t index = 0; index < containerLength; ++index) {
+			if (array.contains(container[index]))
+				continue;
+			if (kept != index)
+				container[kept] = std::move(container[index]);
+			++kept;
 		}
-		return flag;
+		bool removed = (kept != containerLength);
+		containerLength = kept;
+		return removed;
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::removeRange(rsl::size_t fromIndex, rsl::size_t toIndex) {
 		RSL_RUNTIME_BOUND_CHECK_ARG(fromIndex >= containerLength || toIndex >= containerLength || fromIndex > toIndex, "Arguments out of bounds", return;);
-		static rsl::size_t i;
-		for (i = toIndex + 1; i < containerLength; ++i) {
-			container[fromIndex + i - toIndex - 1] = container[i];
-		}
+		rsl::moveRange(container + fromIndex, container + toIndex + 1, containerLength - toIndex - 1);
 		containerLength -= (toIndex - fromIndex + 1);
 	}
 
@@ -618,34 +828,20 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::trimToSize() {
-		if (containerCapacity > containerLength) {
-			static T* newContainer;
-			newContainer = allocator.malloc(sizeof(T[containerLength]));
-			static rsl::size_t i;
-			for (i = 0; i < containerLength; ++i) {
-				newContainer[i] = container[i];
-			}
-			containerCapacity = containerLength;
-			allocator.free(container);
-			container = newContainer;
+		if (containerCapacity == containerLength)
+			return;
+		if (containerLength == 0) {
+			release();
+			return;
 		}
+		reallocate(containerLength);
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::capacity(rsl::size_t capacity) {
-		if (capacity > containerCapacity) {
-			static T* newContainer;
-			newContainer = allocator.malloc(sizeof(T[capacity]));
-			static rsl::size_t i;
-			if (containerLength != 0)
-				for (i = 0; i < containerLength; ++i) {
-					newContainer[i] = container[i];
-				}
-			containerCapacity = capacity;
-			allocator.free(container);
-			container = newContainer;
-		}
+		if (capacity > containerCapacity)
+			reallocate(capacity);
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
@@ -657,8 +853,7 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::contains(const T& element) const {
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			if (container[i] == element)
 				return true;
 		}
@@ -694,10 +889,9 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	rsl::signed_size_t DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::indexOf(const T& element) const {
-		static rsl::signed_size_t i;
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			if (container[i] == element)
-				return i;
+				return static_cast<rsl::signed_size_t>(i);
 		}
 		return -1;
 	}
@@ -705,8 +899,7 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	rsl::signed_size_t DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::lastIndexOf(const T& element) const {
-		static rsl::signed_size_t i;
-		for (i = containerLength - 1; i >= 0; --i) {
+		for (rsl::signed_size_t i = containerLength - 1; i >= 0; --i) {
 			if (container[i] == element)
 				return i;
 		}
@@ -719,12 +912,23 @@ namespace rsl {
 		return container;
 	}
 
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	Span<T> DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::span() {
+		return Span<T>(container, containerLength);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	Span<const T> DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::span() const {
+		return Span<const T>(container, containerLength);
+	}
+
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::print() const {
-		static rsl::size_t i;
 		RSL_PRINT("Array[");
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			RSL_PRINT(container[i]);
 			if (i < containerLength - 1) {
 				RSL_PRINT(",");
@@ -742,25 +946,65 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	typename DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::Iterator DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::end() {
-		return Iterator{container};
+		return Iterator{container + containerLength};
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	template<typename Arg, typename... Args>
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::addVariadic(const Arg& arg, const Args& ... args) {
-		container[containerLength] = arg;
-		++containerLength;
-		addBack(args...);
+		addBack(arg);
+		addVariadic(args...);
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::addVariadic() {}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
-	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::ensureCapacity(rsl::size_t minCapacity) {
-		if (minCapacity > containerCapacity) {
-			capacity((containerCapacity * 3) / 2 + 1);
+	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::ensureCapacity(rsl::size_t minCapacity) {
+		// geometric growth keeps appends amortised O(1)
+		if (minCapacity <= containerCapacity)
+			return true;
+		return reallocate(rsl::max(minCapacity, (containerCapacity * 3) / 2 + 1));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	bool DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::reallocate(rsl::size_t capacity) {
+		if constexpr (TRIVIAL && rsl::hasTryExpand<ALLOCATOR>::value) {
+			if (container != nullptr && allocator.tryExpand(container, sizeof(T) * capacity)) {
+				containerCapacity = capacity;
+				return true;
+			}
 		}
+		T* newContainer = allocator.malloc(sizeof(T) * capacity);
+		if (newContainer == nullptr)
+			return false;
+		if constexpr (TRIVIAL) {
+			if (containerLength != 0)
+				std::memcpy(newContainer, container, sizeof(T) * containerLength);
+		} else {
+			for (rsl::size_t index = 0; index < containerLength; ++index)
+				new(&newContainer[index]) T(std::move(container[index]));
+			for (rsl::size_t index = containerLength; index < capacity; ++index)
+				new(&newContainer[index]) T();
+			for (rsl::size_t index = 0; index < containerCapacity; ++index)
+				container[index].~T();
+		}
+		allocator.free(container);
+		container = newContainer;
+		containerCapacity = capacity;
+		return true;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicArray<T, DEFAULT_CAPACITY, ALLOCATOR>::release() {
+		if constexpr (!std::is_trivially_destructible<T>::value) {
+			for (rsl::size_t index = 0; index < containerCapacity; ++index)
+				container[index].~T();
+		}
+		allocator.free(container);
+		container = nullptr;
+		containerLength = 0;
+		containerCapacity = 0;
 	}
 }
 
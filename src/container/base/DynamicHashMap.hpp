@@ -0,0 +1,492 @@
+//
+// Created by robcholz on 11/16/23.
+//
+#pragma once
+
+#ifndef RSL_DYNAMICHASHMAP_HPP
+#define RSL_DYNAMICHASHMAP_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include <memory/ByteAllocator.hpp>
+#include "HashMap.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage A heap-allocated hash map with O(1) put, find and remove, the slot table doubles when it gets 7/8 full
+	 * @tparam K key type, compared with ==
+	 * @tparam V value type
+	 * @tparam DEFAULT_CAPACITY number of elements the first table holds
+	 * @tparam ALLOCATOR byte allocator the slot table is taken from, one block holds the entries and their metadata
+	 * @tparam HASH hash function object
+	 */
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY = 10, typename ALLOCATOR=ByteAllocator<HashMapEntry<K, V>>, typename HASH=Hash<K>>
+	class RSL_UNUSED DynamicHashMap {
+	private:
+		using Table = RobinHoodTable<K, V, HASH>;
+		using Entry = HashMapEntry<K, V>;
+
+	public:
+		using Iterator = HashMapIterator<K, V>;
+
+		/**
+		 * @usage construct an empty hash map
+		 */
+		DynamicHashMap();
+
+		/**
+		 * @usage copy constructor
+		 * @param other another instance
+		 */
+		DynamicHashMap(const DynamicHashMap& other);
+
+		/**
+		 * @usage take over the table of other
+		 * @param other instance, left empty
+		 */
+		DynamicHashMap(DynamicHashMap&& other) noexcept;
+
+		/**
+		 * @usage copy assignment
+		 * @param other another instance
+		 * @return this instance
+		 */
+		DynamicHashMap& operator=(const DynamicHashMap& other);
+
+		/**
+		 * @usage release the own table and take over the table of other
+		 * @param other instance, left empty
+		 * @return this instance
+		 */
+		DynamicHashMap& operator=(DynamicHashMap&& other) noexcept;
+
+		~DynamicHashMap();
+
+		/**
+		 * @usage get the value of the key, a default constructed value is added if the key is missing
+		 * @param key
+		 * @return the reference of the value, default value if the key is missing and the table can not grow
+		 */
+		V& operator[](const K& key);
+
+		/**
+		 * @usage add the key or replace its value
+		 * @param key
+		 * @param value
+		 * @return false if the key is missing and the table can not grow
+		 */
+		RSL_UNUSED bool put(const K& key, const V& value);
+
+		RSL_UNUSED bool put(const K& key, V&& value);
+
+		/**
+		 * @usage build the value in place if the key is missing, an existing value is left untouched
+		 * @param key
+		 * @param args arguments forwarded to the constructor of V
+		 * @return false if the key is missing and the table can not grow
+		 */
+		template<typename... Args>
+		RSL_UNUSED bool emplace(const K& key, Args&& ... args);
+
+		/**
+		 * @usage look the key up
+		 * @param key
+		 * @return pointer to the value, nullptr if the key is missing
+		 */
+		RSL_UNUSED V* find(const K& key);
+
+		RSL_UNUSED const V* find(const K& key) const;
+
+		/**
+		 * @usage get the value of the key
+		 * @param key
+		 * @return the reference of the value, default value if the key is missing
+		 */
+		RSL_UNUSED V& get(const K& key);
+
+		/**
+		 * @usage remove the key and its value, the table is not shrunk
+		 * @param key
+		 * @return true if the key was found
+		 */
+		RSL_UNUSED bool remove(const K& key);
+
+		/**
+		 * @usage remove every element, the table is kept
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage shrink the table to the smallest one that holds the elements
+		 */
+		RSL_UNUSED void trimToSize();
+
+		/**
+		 * @usage grow the table so that capacity elements fit without another rehash
+		 * @param capacity
+		 */
+		RSL_UNUSED void capacity(rsl::size_t capacity);
+
+		/**
+		 * @usage check if the key is in the map
+		 * @param key
+		 * @return true if found
+		 */
+		RSL_UNUSED bool contains(const K& key) const;
+
+		/**
+		 * @usage check if the hash map is empty
+		 * @return true if empty
+		 */
+		RSL_NODISCARD bool isEmpty() const;
+
+		/**
+		 * @return number of elements
+		 */
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @return number of elements the current table holds before it grows
+		 */
+		RSL_NODISCARD rsl::size_t capacity() const;
+
+		/**
+		 * @usage print every key and value, in slot order
+		 */
+		RSL_UNUSED void print() const;
+
+		/**
+		 * @usage iterator func, visits the elements in slot order
+		 * @return begin
+		 * @attention any insertion may rehash and invalidate iterators
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+
+	private:
+		Entry* container{nullptr};
+		unsigned char* probes{nullptr};
+		rsl::size_t storageCapacity{0};
+		rsl::size_t containerLength{0};
+		ALLOCATOR allocator;
+		inline static V defaultValue{};
+
+		template<typename... Args>
+		V* findOrEmplace(const K& key, Args&& ... args);
+
+		// add a missing key at the slot locate returned, grows the table if needed. nullptr if it can not grow
+		template<typename... Args>
+		V* emplaceAt(rsl::size_t slot, unsigned char probe, const K& key, Args&& ... args);
+
+		bool rehash(rsl::size_t newStorageCapacity);
+
+		void copyFrom(const DynamicHashMap& other);
+
+		void release();
+	};
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::DynamicHashMap() {
+		rehash(Table::storageFor(DEFAULT_CAPACITY));
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::DynamicHashMap(const DynamicHashMap& other) {
+		copyFrom(other);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::DynamicHashMap(DynamicHashMap&& other) noexcept
+			: container(other.container), probes(other.probes), storageCapacity(other.storageCapacity),
+			  containerLength(other.containerLength), allocator(std::move(other.allocator)) {
+		other.container = nullptr;
+		other.probes = nullptr;
+		other.storageCapacity = 0;
+		other.containerLength = 0;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>&
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::operator=(const DynamicHashMap& other) {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		release();
+		copyFrom(other);
+		return *this;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>&
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::operator=(DynamicHashMap&& other) noexcept {
+		if (this == &other)
+			return *this;
+		release();
+		container = other.container;
+		probes = other.probes;
+		storageCapacity = other.storageCapacity;
+		containerLength = other.containerLength;
+		allocator = std::move(other.allocator);
+		other.container = nullptr;
+		other.probes = nullptr;
+		other.storageCapacity = 0;
+		other.containerLength = 0;
+		return *this;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::~DynamicHashMap() {
+		release();
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	V& DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::operator[](const K& key) {
+		V* value = findOrEmplace(key);
+		RSL_RUNTIME_BOUND_CHECK_ARG(value == nullptr, "Hash map can not grow, key is not added", return defaultValue;);
+		return *value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::put(const K& key, const V& value) {
+		rsl::size_t slot = 0;
+		unsigned char probe = 1;
+		if (storageCapacity != 0 && Table::locate(container, probes, storageCapacity - 1, key, slot, probe)) {
+			container[slot].value = value;
+			return true;
+		}
+		return emplaceAt(slot, probe, key, value) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::put(const K& key, V&& value) {
+		rsl::size_t slot = 0;
+		unsigned char probe = 1;
+		if (storageCapacity != 0 && Table::locate(container, probes, storageCapacity - 1, key, slot, probe)) {
+			container[slot].value = std::move(value);
+			return true;
+		}
+		return emplaceAt(slot, probe, key, std::move(value)) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	template<typename... Args>
+	RSL_UNUSED
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::emplace(const K& key, Args&& ... args) {
+		return findOrEmplace(key, std::forward<Args>(args)...) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	V* DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::find(const K& key) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (containerLength == 0 || !Table::locate(container, probes, storageCapacity - 1, key, slot, probe))
+			return nullptr;
+		return &container[slot].value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	const V* DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::find(const K& key) const {
+		return const_cast<DynamicHashMap*>(this)->find(key);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	V& DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::get(const K& key) {
+		V* value = find(key);
+		RSL_RUNTIME_BOUND_CHECK_ARG(value == nullptr, "Key not found", return defaultValue;);
+		return *value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::remove(const K& key) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (containerLength == 0 || !Table::locate(container, probes, storageCapacity - 1, key, slot, probe))
+			return false;
+		Table::erase(container, probes, storageCapacity - 1, slot);
+		--containerLength;
+		return true;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::empty() {
+		if (containerLength == 0)
+			return;
+		Table::clear(container, probes, storageCapacity);
+		containerLength = 0;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::trimToSize() {
+		rsl::size_t newStorageCapacity = Table::storageFor(containerLength);
+		if (newStorageCapacity < storageCapacity)
+			rehash(newStorageCapacity);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::capacity(rsl::size_t capacity) {
+		rsl::size_t newStorageCapacity = Table::storageFor(capacity);
+		if (newStorageCapacity > storageCapacity)
+			rehash(newStorageCapacity);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::contains(const K& key) const {
+		return find(key) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_NODISCARD
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::isEmpty() const {
+		return (containerLength == 0);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_NODISCARD
+	rsl::size_t DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::length() const {
+		return containerLength;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_NODISCARD
+	rsl::size_t DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::capacity() const {
+		return Table::maxLength(storageCapacity);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	RSL_UNUSED
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::print() const {
+		RSL_PRINT("{");
+		for (const Entry& entry: *this) {
+			RSL_PRINT(entry.key);
+			RSL_PRINT(": ");
+			RSL_PRINT(entry.value);
+			RSL_PRINT(", ");
+		}
+		RSL_PRINTF("}");
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	typename DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::Iterator DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::begin() const {
+		return Iterator(container, probes, 0, storageCapacity);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	typename DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::Iterator DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::end() const {
+		return Iterator(container, probes, storageCapacity, storageCapacity);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	template<typename... Args>
+	V* DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::findOrEmplace(const K& key, Args&& ... args) {
+		rsl::size_t slot = 0;
+		unsigned char probe = 1;
+		if (storageCapacity != 0 && Table::locate(container, probes, storageCapacity - 1, key, slot, probe))
+			return &container[slot].value;
+		return emplaceAt(slot, probe, key, std::forward<Args>(args)...);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	template<typename... Args>
+	V* DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::emplaceAt(rsl::size_t slot, unsigned char probe, const K& key, Args&& ... args) {
+		// built before shifting or rehashing, key and args may refer to an entry of the map
+		Entry entry{key, V(std::forward<Args>(args)...)};
+		// a full table or a probe distance overflow gets one rehash, insert leaves the entry untouched when it fails
+		if (containerLength < Table::maxLength(storageCapacity) &&
+		    Table::insert(container, probes, storageCapacity - 1, slot, probe, std::move(entry))) {
+			++containerLength;
+			return &container[slot].value;
+		}
+		if (!rehash(storageCapacity == 0 ? Table::storageFor(DEFAULT_CAPACITY) : storageCapacity * 2))
+			return nullptr;
+		Table::locate(container, probes, storageCapacity - 1, entry.key, slot, probe);
+		if (!Table::insert(container, probes, storageCapacity - 1, slot, probe, std::move(entry))) {
+			RSL_LOG_ERROR("Probe distance overflow, check the hash function");
+			return nullptr;
+		}
+		++containerLength;
+		return &container[slot].value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	bool DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::rehash(rsl::size_t newStorageCapacity) {
+		auto* newContainer = allocator.malloc(sizeof(Entry) * newStorageCapacity + newStorageCapacity);
+		RSL_RUNTIME_BOUND_CHECK_ARG(newContainer == nullptr, "Allocation failed, hash map is not resized", return false;);
+		auto* newProbes = reinterpret_cast<unsigned char*>(newContainer + newStorageCapacity);
+		std::memset(newProbes, Table::EMPTY, newStorageCapacity);
+		const rsl::size_t newMask = newStorageCapacity - 1;
+		for (rsl::size_t slot = 0; slot < storageCapacity; ++slot) {
+			if (probes[slot] == Table::EMPTY)
+				continue;
+			rsl::size_t newSlot;
+			unsigned char probe;
+			Table::locate(newContainer, newProbes, newMask, container[slot].key, newSlot, probe);
+			Entry entry{container[slot].key, std::move(container[slot].value)};
+			if (!Table::insert(newContainer, newProbes, newMask, newSlot, probe, std::move(entry))) {
+				// give the values moved so far back, the old table stays as it was
+				container[slot].value = std::move(entry.value);
+				for (rsl::size_t moved = 0; moved < slot; ++moved) {
+					if (probes[moved] == Table::EMPTY)
+						continue;
+					Table::locate(newContainer, newProbes, newMask, container[moved].key, newSlot, probe);
+					container[moved].value = std::move(newContainer[newSlot].value);
+				}
+				Table::clear(newContainer, newProbes, newStorageCapacity);
+				allocator.free(newContainer);
+				RSL_LOG_ERROR("Probe distance overflow, hash map is not resized");
+				return false;
+			}
+		}
+		if (container != nullptr) {
+			Table::clear(container, probes, storageCapacity);
+			allocator.free(container);
+		}
+		container = newContainer;
+		probes = newProbes;
+		storageCapacity = newStorageCapacity;
+		return true;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::copyFrom(const DynamicHashMap& other) {
+		containerLength = 0;
+		if (!rehash(other.storageCapacity == 0 ? Table::storageFor(DEFAULT_CAPACITY) : other.storageCapacity))
+			return;
+		// same table size and hash, so every entry goes to the same slot
+		for (rsl::size_t slot = 0; slot < storageCapacity; ++slot) {
+			if (other.probes != nullptr && other.probes[slot] != Table::EMPTY)
+				new(container + slot) Entry{other.container[slot]};
+			probes[slot] = other.probes == nullptr ? Table::EMPTY : other.probes[slot];
+		}
+		containerLength = other.containerLength;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR, typename HASH>
+	void DynamicHashMap<K, V, DEFAULT_CAPACITY, ALLOCATOR, HASH>::release() {
+		if (container == nullptr)
+			return;
+		Table::clear(container, probes, storageCapacity);
+		allocator.free(container);
+		container = nullptr;
+		probes = nullptr;
+		storageCapacity = 0;
+		containerLength = 0;
+	}
+}
+
+#endif //RSL_DYNAMICHASHMAP_HPP
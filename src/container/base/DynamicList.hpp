@@ -7,7 +7,9 @@
 #define RSL_DYNAMICLIST_HPP
 
 #include <memory/ObjectAllocator.hpp>
+#include <memory/SlabAllocator.hpp>
 #include <Internal.hpp>
+#include <utils/Utils.hpp>
 #include "List.hpp"
 
 
@@ -16,8 +18,9 @@ namespace rsl {
 	 * @usage A heap-allocated list
 	 * @tparam T element type
 	 * @tparam DEFAULT_CAPACITY this param has no effect
+	 * @tparam ALLOCATOR node allocator, the default pools nodes in chunks instead of calling malloc per node
  	 */
-	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename ALLOCATOR=ObjectAllocator<DoublyListNode<T>>>
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename ALLOCATOR=SlabAllocator<DoublyListNode<T>>>
 	class RSL_UNUSED DynamicList {
 	private:
 		using ListNode = DoublyListNode<T>;
@@ -44,11 +47,30 @@ namespace rsl {
 		template<rsl::size_t DEFAULT_CAPACITY_, typename ALLOCATOR_>
 		explicit DynamicList(const DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>& other);
 
+		DynamicList(const DynamicList& other);
+
+		/**
+		 * @usage take over the node chain of other together with its allocator, if the allocator cannot be moved
+		 * the elements are moved one by one
+		 * @param other instance, left empty
+		 */
+		DynamicList(DynamicList&& other) noexcept;
+
 		/**
  		 * @usage default destructor
          */
 		~DynamicList();
 
+		DynamicList& operator=(const DynamicList& other);
+
+		/**
+		 * @usage release the own nodes and take over the node chain of other together with its allocator, if the
+		 * allocator cannot be moved the elements are moved one by one
+		 * @param other instance, left empty
+		 * @return this instance
+		 */
+		DynamicList& operator=(DynamicList&& other) noexcept;
+
 		/**
 		 * @usage copy constructor
 		 * @param other instance
@@ -59,10 +81,9 @@ namespace rsl {
 		DynamicList& operator=(const DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>& other);
 
 		/**
-		 * @usage move constructor
-		 * @param other instance
+		 * @usage move assignment from a list of another type, the elements are moved one by one
+		 * @param other instance, left empty
 		 * @return new instance
-		 * @attention if the length of the copied list is larger than the capacity of the list copied to, the list will be filled
 		 */
 		template<rsl::size_t DEFAULT_CAPACITY_, typename ALLOCATOR_>
 		DynamicList& operator=(DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>&& other) noexcept;
@@ -96,6 +117,8 @@ namespace rsl {
 
 		RSL_UNUSED void addFront(const T& element);
 
+		RSL_UNUSED void addFront(T&& element);
+
 		/**
 		 * @usage addBack an element to the end of the list
 		 * @param element
@@ -103,6 +126,22 @@ namespace rsl {
 		 */
 		RSL_UNUSED void addBack(const T& element);
 
+		RSL_UNUSED void addBack(T&& element);
+
+		/**
+		 * @usage construct an element in place at the front of the list
+		 * @param args arguments forwarded to the constructor of T
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the list
+		 * @param args arguments forwarded to the constructor of T
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
 		template<rsl::size_t DEFAULT_CAPACITY_, typename ALLOCATOR_>
 		RSL_UNUSED void appendFront(const DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>& list);
 
@@ -226,9 +265,8 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator++(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator++(int) {
+				Iterator temp = *this;
 				++(*this);
 				return temp;
 			}
@@ -238,16 +276,26 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator--(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator--(int) {
+				Iterator temp = *this;
 				--(*this);
 				return temp;
 			}
 		};
 
+		DynamicList(DynamicList&& other, std::true_type);
+
+		DynamicList(DynamicList&& other, std::false_type);
+
 		RSL_UNUSED void init();
 
+		void release();
+
+		template<typename... Args>
+		ListNode* createNode(Args&& ... args);
+
+		void destroyNode(ListNode* node);
+
 		/**
  		 * @usage remove the element at the given pointer
 		 * @param pointer
@@ -277,18 +325,18 @@ namespace rsl {
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList() :
-			size(0),
 			head(nullptr),
-			tail(nullptr) {
+			tail(nullptr),
+			size(0) {
 		init();
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	template<typename... Args>
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList(const Args& ... args) :
-			size(0),
 			head(nullptr),
-			tail(nullptr) {
+			tail(nullptr),
+			size(0) {
 		init();
 		(addVariadic((args)...));
 	}
@@ -302,16 +350,82 @@ namespace rsl {
 		}
 	}
 
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList(const DynamicList& other) :
+			head(nullptr),
+			tail(nullptr),
+			size(0) {
+		init();
+		for (const auto& element: other) {
+			addBack(element);
+		}
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList(DynamicList&& other) noexcept :
+			DynamicList(std::move(other), typename std::is_move_constructible<ALLOCATOR>::type{}) {}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList(DynamicList&& other, std::true_type) :
+			head(other.head),
+			tail(other.tail),
+			size(other.size),
+			allocator(std::move(other.allocator)) {
+		// the nodes went along with the allocator, other gets a fresh pair of sentinels
+		other.size = 0;
+		other.init();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicList(DynamicList&& other, std::false_type) :
+			head(nullptr),
+			tail(nullptr),
+			size(0) {
+		init();
+		for (auto& element: other) {
+			addBack(std::move(element));
+		}
+		other.empty();
+	}
+
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::~DynamicList() {
-		static ListNode* node, * node_reserved;
-		node = tail;
-		while (node->prev != nullptr) {
-			node_reserved = node->prev;
-			allocator.free(node);
-			node = node_reserved;
+		release();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(const DynamicList& other) {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		empty();
+		for (const auto& element: other) {
+			addBack(element);
 		}
-		allocator.free(head);
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>& DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(DynamicList&& other) noexcept {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		if constexpr (std::is_move_assignable<ALLOCATOR>::value) {
+			release();
+			allocator = std::move(other.allocator);
+			head = other.head;
+			tail = other.tail;
+			size = other.size;
+			other.size = 0;
+			other.init();
+		} else {
+			empty();
+			for (auto& element: other) {
+				addBack(std::move(element));
+			}
+			other.empty();
+		}
+		return *this;
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
@@ -319,9 +433,9 @@ namespace rsl {
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>&
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(const DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>& other) {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
-		init();
+		empty();
 		for (const auto& element: other) {
 			addBack(element);
 		}
@@ -333,12 +447,13 @@ namespace rsl {
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>&
 	DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(DynamicList<T, DEFAULT_CAPACITY_, ALLOCATOR_>&& other) noexcept {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
-		init();
-		for (const auto& element: other) {
-			addBack(element);
+		empty();
+		for (auto& element: other) {
+			addBack(std::move(element));
 		}
+		other.empty();
 		return *this;
 	}
 
@@ -381,11 +496,34 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::addFront(const T& element) {
-		static ListNode* node_new;
-		node_new = allocator.malloc();
-		RSL_RUNTIME_BOUND_CHECK_ARG(node_new == nullptr, "Allocation failed, current objects: " + RSL_TO_STR_NUM(allocator.length())
+		emplaceFront(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::addFront(T&& element) {
+		emplaceFront(std::move(element));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(const T& element) {
+		emplaceBack(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(T&& element) {
+		emplaceBack(std::move(element));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceFront(Args&& ... args) {
+		ListNode* node_new = createNode(std::forward<Args>(args)...);
+		RSL_RUNTIME_BOUND_CHECK_ARG(node_new == nullptr, "Allocation failed, current objects: " + RSL_TO_STR_NUM(allocator.size())
 		                                                 + " max objects: " + RSL_TO_STR_NUM(allocator.maxObjects()), return;);
-		node_new->data = element;
 
 		node_new->next = head->next; // r next
 		head->next->prev = node_new; // r prev
@@ -396,13 +534,12 @@ namespace rsl {
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
 	RSL_UNUSED
-	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(const T& element) {
-		static ListNode* node_new;
-		node_new = allocator.malloc();
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceBack(Args&& ... args) {
+		ListNode* node_new = createNode(std::forward<Args>(args)...);
 		RSL_RUNTIME_BOUND_CHECK_ARG(node_new == nullptr, "Allocation failed, current objects: " + RSL_TO_STR_NUM(allocator.size())
 		                                                 + " max objects: " + RSL_TO_STR_NUM(allocator.maxObjects()), return;);
-		node_new->data = element;
 
 		tail->prev->next = node_new;
 		node_new->prev = tail->prev;
@@ -459,9 +596,8 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	bool DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::searchRemove(const T& element) {
-		static ListNode* before;
-		before = head->next;
-		while (before != nullptr && before->next != nullptr) {
+		ListNode* before = head;
+		while (before->next != tail) {
 			if (before->next->data == element) {
 				DynamicList::remove(before, before->next->next);
 				return true;
@@ -475,22 +611,21 @@ namespace rsl {
 	template<rsl::size_t DEFAULT_CAPACITY_>
 	RSL_UNUSED
 	bool DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::removeAll(const DynamicList<T, DEFAULT_CAPACITY_>& list) {
-		static bool flag = false;
+		bool removed = false;
 		for (const auto& element: list) {
-			searchRemove(element);
-			flag = true;
+			while (searchRemove(element))
+				removed = true;
 		}
-		return flag;
+		return removed;
 	}
 
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::empty() {
-		static ListNode* reservedNode, * node;
-		reservedNode = tail->prev;
-		while (reservedNode == nullptr) {
-			node = reservedNode->prev;
-			allocator.free(reservedNode);
+		ListNode* reservedNode = tail->prev;
+		while (reservedNode != head) {
+			ListNode* node = reservedNode->prev;
+			destroyNode(reservedNode);
 			reservedNode = node;
 		}
 		head->next = tail;
@@ -529,8 +664,7 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::print() const {
-		static rsl::size_t i;
-		i = 0;
+		rsl::size_t i = 0;
 		RSL_PRINT("DynamicList[");
 		for (const auto& element: *this) {
 			RSL_PRINT(element);
@@ -557,20 +691,45 @@ namespace rsl {
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::init() {
-		head = allocator.malloc();
-		tail = allocator.malloc();
-		head->data = defaultValue;
-		tail->data = defaultValue;
+		head = createNode(defaultValue);
+		tail = createNode(defaultValue);
 		head->next = tail;
 		tail->next = nullptr;
 		head->prev = nullptr;
 		tail->prev = head;
 	}
 
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::release() {
+		ListNode* node = tail;
+		while (node != nullptr) {
+			ListNode* previous = node->prev;
+			destroyNode(node);
+			node = previous;
+		}
+		head = tail = nullptr;
+		size = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	typename DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::ListNode* DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::createNode(Args&& ... args) {
+		ListNode* node = allocator.malloc();
+		if (node == nullptr)
+			return nullptr;
+		return new(node) ListNode{T(std::forward<Args>(args)...), nullptr, nullptr};
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::destroyNode(ListNode* node) {
+		node->~ListNode();
+		allocator.free(node);
+	}
+
 	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
 	RSL_UNUSED
 	void DynamicList<T, DEFAULT_CAPACITY, ALLOCATOR>::remove(ListNode* before, ListNode* after) {
-		allocator.free(before->next);
+		destroyNode(before->next);
 		before->next = after;
 		after->prev = before;
 		--size;
@@ -0,0 +1,690 @@
+//
+// Created by robcholz on 11/4/23.
+//
+#pragma once
+
+#ifndef RSL_DYNAMICRINGBUFFER_HPP
+#define RSL_DYNAMICRINGBUFFER_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "Span.hpp"
+#include <memory/ByteAllocator.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage A heap-allocated, fixed-size ring buffer with O(1) add and pop at both ends
+	 * @tparam T element type
+	 * @tparam DEFAULT_CAPACITY default ring buffer capacity, the storage is rounded up to a power of two so indexes can be masked
+	 * @tparam ALLOCATOR byte allocator the storage is taken from
+	 */
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename ALLOCATOR=ByteAllocator<T>>
+	class RSL_UNUSED DynamicRingBuffer {
+	public:
+		/**
+		 * @usage construct a dynamic ring buffer object
+		 */
+		DynamicRingBuffer();
+
+		/**
+		 * @usage construct with arguments
+		 * @tparam Args type that matches T
+		 * @param args parameter list
+		 * @attention the length of the args should not be larger than the capacity
+		 */
+		template<typename... Args>
+		explicit DynamicRingBuffer(const Args& ... args);
+
+		/**
+		 * @usage copy constructor
+		 * @param other another instance
+		 */
+		DynamicRingBuffer(const DynamicRingBuffer& other);
+
+		/**
+		 * @usage copy assignment
+		 * @param other instance
+		 * @return this instance
+		 */
+		DynamicRingBuffer& operator=(const DynamicRingBuffer& other);
+
+		/**
+		 * @usage move constructor, takes over the storage of other if the allocator can be moved, other gets a fresh one
+		 * @param other another instance
+		 */
+		DynamicRingBuffer(DynamicRingBuffer&& other) noexcept;
+
+		/**
+		 * @usage move assignment
+		 * @param other instance
+		 * @return this instance
+		 */
+		DynamicRingBuffer& operator=(DynamicRingBuffer&& other) noexcept;
+
+		/**
+		 * @usage get the reference of the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the reference of the element at the given index, default value if out of bound
+		 */
+		T& operator[](rsl::size_t index);
+
+		/**
+		 * @usage get the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the element at the given index, default value if out of bound
+		 */
+		const T& operator[](rsl::size_t index) const;
+
+		/**
+		 * @usage default destructor
+		 */
+		~DynamicRingBuffer();
+
+		/**
+		 * @usage add an element to the front of the ring buffer
+		 * @param element
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		RSL_UNUSED void addFront(const T& element);
+
+		RSL_UNUSED void addFront(T&& element);
+
+		/**
+		 * @usage add an element to the end of the ring buffer
+		 * @param element
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		RSL_UNUSED void addBack(const T& element);
+
+		RSL_UNUSED void addBack(T&& element);
+
+		/**
+		 * @usage construct an element in place at the front of the ring buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the ring buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		RSL_UNUSED void popFront();
+
+		RSL_UNUSED void popBack();
+
+		/**
+		 * @usage empty the entire ring buffer
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage shrink the storage to the current length, rounded up to a power of two
+		 * @attention the capacity never drops below one
+		 */
+		RSL_UNUSED void trimToSize();
+
+		/**
+		 * @usage grow the capacity of the ring buffer, the elements are moved to the start of the new storage
+		 * @param capacity new capacity
+		 * @attention operation will be ignored if capacity is not larger than the current one
+		 */
+		RSL_UNUSED void capacity(rsl::size_t capacity);
+
+		/**
+		 * @usage check if the ring buffer is empty
+		 * @return true if empty
+		 */
+		RSL_NODISCARD bool isEmpty() const;
+
+		/**
+		 * @usage check if the ring buffer is full
+		 * @return true if full
+		 */
+		RSL_NODISCARD bool isFull() const;
+
+		/**
+		 * @usage check if an element is contained in the ring buffer
+		 * @param element
+		 * @return true if the given element is contained
+		 */
+		RSL_UNUSED bool contains(const T& element) const;
+
+		/**
+		 * @usage get the length of the ring buffer
+		 * @return the length of the ring buffer
+		 */
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @usage get the capacity, max elements the ring buffer can hold
+		 * @return capacity
+		 */
+		RSL_NODISCARD rsl::size_t capacity() const;
+
+		/**
+		 * @usage get the reference of the element at the given index, counted from the front. this is equivalent to operator[]
+		 * @param index
+		 * @return the reference of the element, the default value of T if index out of bound
+		 */
+		RSL_UNUSED T& get(rsl::size_t index);
+
+		/**
+		 * @usage get the element at the given index, counted from the front. this is equivalent to operator[]
+		 * @param index
+		 * @return the element, the default value of T if index out of bound
+		 */
+		RSL_UNUSED T get(rsl::size_t index) const;
+
+		/**
+		 * @usage get the first contiguous segment of the ring buffer, starting at the front
+		 * @param segmentLength receives the number of elements in the segment
+		 * @return the const pointer to the first element of the segment
+		 */
+		RSL_UNUSED const T* firstSegment(rsl::size_t& segmentLength) const;
+
+		/**
+		 * @usage get the second contiguous segment of the ring buffer, the part that wrapped around to the start of the storage
+		 * @param segmentLength receives the number of elements in the segment, 0 if the elements do not wrap
+		 * @return the const pointer to the first element of the segment
+		 */
+		RSL_UNUSED const T* secondSegment(rsl::size_t& segmentLength) const;
+
+		/**
+		 * @usage get a view of the elements as the two segments above, nothing is copied
+		 * @return the view, invalidated by anything that adds or removes elements
+		 */
+		RSL_NODISCARD RingSpan<T> span();
+
+		RSL_NODISCARD RingSpan<const T> span() const;
+
+		/**
+		 * @usage print the ring buffer
+		 */
+		RSL_UNUSED void print() const;
+
+	private:
+		T* container{nullptr}; // row array, storageCapacity elements
+		rsl::size_t storageCapacity{0}; // always a power of two
+		rsl::size_t mask{0};
+		rsl::size_t head{0}; // masked index of the front element
+		rsl::size_t containerLength{0}; // the current length of the ring buffer
+		rsl::size_t containerCapacity{0};
+		inline static T defaultValue{0};
+		ALLOCATOR allocator;
+
+		DynamicRingBuffer(DynamicRingBuffer&& other, std::true_type);
+
+		DynamicRingBuffer(DynamicRingBuffer&& other, std::false_type);
+
+		void relocate(rsl::size_t capacity);
+
+		void release();
+
+		template<typename Arg, typename... Args>
+		void addVariadic(const Arg& arg, const Args& ... args);
+
+		void addVariadic();
+
+	public:
+		class RSL_UNUSED Iterator {
+		private:
+			T* containerPtr;
+			rsl::size_t mask;
+			rsl::size_t current; // unmasked index, masked on access
+
+		public:
+			using iterator_category RSL_UNUSED = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			RSL_UNUSED
+			Iterator(pointer ptr, rsl::size_t mask, rsl::size_t current) : containerPtr(ptr), mask(mask), current(current) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current && containerPtr == other.containerPtr;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(current == other.current && containerPtr == other.containerPtr);
+			}
+
+			reference operator*() const {
+				return containerPtr[current & mask];
+			}
+
+			pointer operator->() const {
+				return &(containerPtr[current & mask]);
+			}
+
+			reference operator[](difference_type offset) const {
+				return containerPtr[(current + offset) & mask];
+			}
+
+			Iterator& operator++() {
+				++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			Iterator& operator--() {
+				--current;
+				return *this;
+			}
+
+			Iterator operator--(int) {
+				Iterator temp = *this;
+				--(*this);
+				return temp;
+			}
+
+			Iterator& operator+=(difference_type offset) {
+				current += offset;
+				return *this;
+			}
+
+			Iterator& operator-=(difference_type offset) {
+				current -= offset;
+				return *this;
+			}
+
+			Iterator operator+(difference_type offset) const {
+				return Iterator(containerPtr, mask, current + offset);
+			}
+
+			Iterator operator-(difference_type offset) const {
+				return Iterator(containerPtr, mask, current - offset);
+			}
+
+			difference_type operator-(const Iterator& other) const {
+				return static_cast<difference_type>(current - other.current);
+			}
+		};
+
+		/**
+		 * @usage iterator func
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+	};
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer() {
+		relocate(DEFAULT_CAPACITY);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer(const Args& ... args) {
+		relocate(rsl::max(DEFAULT_CAPACITY, sizeof...(args)));
+		(addVariadic((args)...));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer(const DynamicRingBuffer& other) {
+		relocate(other.containerCapacity);
+		for (const auto& element: other)
+			addBack(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>&
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(const DynamicRingBuffer& other) {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		empty();
+		capacity(other.containerCapacity);
+		for (const auto& element: other)
+			addBack(element);
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer(DynamicRingBuffer&& other) noexcept
+			: DynamicRingBuffer(std::move(other), typename std::is_move_constructible<ALLOCATOR>::type{}) {}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer(DynamicRingBuffer&& other, std::true_type)
+			: container(other.container), storageCapacity(other.storageCapacity), mask(other.mask), head(other.head),
+			  containerLength(other.containerLength), containerCapacity(other.containerCapacity), allocator(std::move(other.allocator)) {
+		// nothing is left to release, other starts over like a default constructed ring buffer
+		other.container = nullptr;
+		other.storageCapacity = other.mask = other.head = 0;
+		other.containerLength = other.containerCapacity = 0;
+		other.relocate(DEFAULT_CAPACITY);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::DynamicRingBuffer(DynamicRingBuffer&& other, std::false_type) {
+		// the storage may live inside the allocator of other, e.g. InlineAllocator
+		relocate(other.containerCapacity);
+		for (T& element: other)
+			addBack(std::move(element));
+		other.empty();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>&
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::operator=(DynamicRingBuffer&& other) noexcept {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		if constexpr (std::is_move_assignable<ALLOCATOR>::value) {
+			release();
+			container = other.container;
+			storageCapacity = other.storageCapacity;
+			mask = other.mask;
+			head = other.head;
+			containerLength = other.containerLength;
+			containerCapacity = other.containerCapacity;
+			allocator = std::move(other.allocator);
+			other.container = nullptr;
+			other.storageCapacity = other.mask = other.head = 0;
+			other.containerLength = other.containerCapacity = 0;
+			other.relocate(DEFAULT_CAPACITY);
+		} else {
+			empty();
+			capacity(other.containerCapacity);
+			for (T& element: other)
+				addBack(std::move(element));
+			other.empty();
+		}
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::operator[](rsl::size_t index) {
+		return get(index);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	const T& DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::operator[](rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & mask];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::~DynamicRingBuffer() {
+		release();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addFront(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, addFront failed", return;);
+		head = (head - 1) & mask;
+		container[head] = element;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addFront(T&& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, addFront failed", return;);
+		head = (head - 1) & mask;
+		container[head] = std::move(element);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, addBack failed", return;);
+		container[(head + containerLength) & mask] = element;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addBack(T&& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, addBack failed", return;);
+		container[(head + containerLength) & mask] = std::move(element);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceFront(Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, emplaceFront failed", return;);
+		// the slot is outside the ring buffer, args can not refer to it
+		rsl::reconstruct(container[(head - 1) & mask], std::forward<Args>(args)...);
+		head = (head - 1) & mask;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::emplaceBack(Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= containerCapacity, "Out of Capacity, emplaceBack failed", return;);
+		rsl::reconstruct(container[(head + containerLength) & mask], std::forward<Args>(args)...);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::front() const {
+		return container[head];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::back() const {
+		return container[(head + containerLength - 1) & mask];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::popFront() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength == 0, "Ring buffer is empty, popFront failed", return;);
+		head = (head + 1) & mask;
+		--containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::popBack() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength == 0, "Ring buffer is empty, popBack failed", return;);
+		--containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::empty() {
+		head = 0;
+		containerLength = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::trimToSize() {
+		// keep room for one element, an empty buffer would otherwise end up with no capacity at all
+		rsl::size_t capacity = rsl::max<rsl::size_t>(containerLength, 1);
+		if (rsl::nextPowerOfTwo(capacity) < storageCapacity)
+			relocate(capacity);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::capacity(rsl::size_t capacity) {
+		if (capacity > containerCapacity)
+			relocate(capacity);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	bool DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::isEmpty() const {
+		return (containerLength == 0);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	bool DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::isFull() const {
+		return (containerLength == containerCapacity);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	bool DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::contains(const T& element) const {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
+			if (container[(head + i) & mask] == element)
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	rsl::size_t DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::length() const {
+		return containerLength;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	rsl::size_t DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::capacity() const {
+		return containerCapacity;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::get(rsl::size_t index) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & mask];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::get(rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & mask];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	const T* DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::firstSegment(rsl::size_t& segmentLength) const {
+		segmentLength = rsl::min(containerLength, storageCapacity - head);
+		return container + head;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	const T* DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::secondSegment(rsl::size_t& segmentLength) const {
+		segmentLength = containerLength - rsl::min(containerLength, storageCapacity - head);
+		return container;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	RingSpan<T> DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::span() {
+		rsl::size_t firstLength = rsl::min(containerLength, storageCapacity - head);
+		return RingSpan<T>(Span<T>(container + head, firstLength), Span<T>(container, containerLength - firstLength));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	RingSpan<const T> DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::span() const {
+		rsl::size_t firstLength = rsl::min(containerLength, storageCapacity - head);
+		return RingSpan<const T>(Span<const T>(container + head, firstLength),
+		                         Span<const T>(container, containerLength - firstLength));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::print() const {
+		RSL_PRINT("RingBuffer[");
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
+			RSL_PRINT(container[(head + i) & mask]);
+			if (i < containerLength - 1) {
+				RSL_PRINT(",");
+			}
+		}
+		RSL_PRINT("]");
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	typename DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::Iterator DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::begin() const {
+		return Iterator(container, mask, head);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	typename DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::Iterator DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::end() const {
+		return Iterator(container, mask, head + containerLength);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::relocate(rsl::size_t capacity) {
+		rsl::size_t newStorageCapacity = rsl::nextPowerOfTwo(capacity);
+		T* newContainer = allocator.malloc(sizeof(T) * newStorageCapacity);
+		RSL_RUNTIME_BOUND_CHECK_ARG(newContainer == nullptr, "Allocation failed, ring buffer is not resized", return;);
+		rsl::size_t i;
+		for (i = 0; i < containerLength; ++i)
+			new(newContainer + i) T(container[(head + i) & mask]);
+		for (; i < newStorageCapacity; ++i)
+			new(newContainer + i) T();
+		release();
+		container = newContainer;
+		storageCapacity = newStorageCapacity;
+		mask = newStorageCapacity - 1;
+		head = 0;
+		containerCapacity = rsl::max(capacity, containerLength);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::release() {
+		if (container == nullptr)
+			return;
+		for (rsl::size_t i = 0; i < storageCapacity; ++i)
+			container[i].~T();
+		allocator.free(container);
+		container = nullptr;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	template<typename Arg, typename... Args>
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addVariadic(const Arg& arg, const Args& ... args) {
+		addBack(arg);
+		addVariadic(args...);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, typename ALLOCATOR>
+	void DynamicRingBuffer<T, DEFAULT_CAPACITY, ALLOCATOR>::addVariadic() {}
+}
+
+
+#endif //RSL_DYNAMICRINGBUFFER_HPP
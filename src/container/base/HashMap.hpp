@@ -0,0 +1,201 @@
+//
+// Created by robcholz on 11/16/23.
+//
+#pragma once
+
+#ifndef RSL_HASHMAP_HPP
+#define RSL_HASHMAP_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	template<typename K, typename V>
+	struct HashMapEntry {
+		K key;
+		V value;
+	};
+
+	/**
+	 * @usage default hash of the hash maps. integers, enums and pointers are mixed directly, anything else goes
+	 * through std::hash first
+	 * @tparam K key type
+	 */
+	template<typename K>
+	struct Hash {
+		rsl::size_t operator()(const K& key) const {
+			unsigned long long value;
+			if constexpr (std::is_integral<K>::value || std::is_enum<K>::value)
+				value = static_cast<unsigned long long>(key);
+			else if constexpr (std::is_pointer<K>::value)
+				value = reinterpret_cast<std::uintptr_t>(key);
+			else
+				value = std::hash<K>{}(key);
+			// finalizer of splitmix64, spreads sequential ids over the whole table
+			value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+			return static_cast<rsl::size_t>(value ^ (value >> 31));
+		}
+	};
+
+	/**
+	 * @usage Robin Hood open addressing over a power of two slot table, shared by StaticHashMap and DynamicHashMap.
+	 * every slot has one byte of metadata, 0 for empty and probe distance + 1 otherwise. a lookup stops at the first
+	 * slot that is closer to its home than the key would be, and both insert and remove shift the run behind the
+	 * slot, so there are no tombstones and lookups never slow down after removals
+	 * @tparam K key type
+	 * @tparam V value type
+	 * @tparam HASH hash function object
+	 * @attention entries are raw memory, only slots with non zero metadata hold a constructed entry
+	 */
+	template<typename K, typename V, typename HASH>
+	struct RobinHoodTable {
+		using Entry = HashMapEntry<K, V>;
+
+		static constexpr unsigned char EMPTY = 0;
+		static constexpr unsigned char MAX_PROBE = 255;
+
+		/**
+		 * @usage largest number of elements a table of storageCapacity slots takes, keeps the load factor at 7/8
+		 */
+		static constexpr rsl::size_t maxLength(rsl::size_t storageCapacity) {
+			return storageCapacity - storageCapacity / 8;
+		}
+
+		/**
+		 * @usage smallest table that holds length elements
+		 */
+		static constexpr rsl::size_t storageFor(rsl::size_t length) {
+			rsl::size_t storageCapacity = rsl::nextPowerOfTwo(length);
+			while (maxLength(storageCapacity) < length)
+				storageCapacity <<= 1;
+			return storageCapacity;
+		}
+
+		/**
+		 * @usage look the key up
+		 * @param slot the slot of the key if found, otherwise the slot a new key would be inserted at
+		 * @param probe metadata of that slot for the key
+		 * @return true if found
+		 */
+		static bool locate(const Entry* entries, const unsigned char* probes, rsl::size_t mask, const K& key,
+		                   rsl::size_t& slot, unsigned char& probe) {
+			slot = HASH{}(key) & mask;
+			probe = 1;
+			while (probes[slot] >= probe) {
+				if (probes[slot] == probe && entries[slot].key == key)
+					return true;
+				slot = (slot + 1) & mask;
+				if (++probe == MAX_PROBE)
+					return false;
+			}
+			return false;
+		}
+
+		/**
+		 * @usage put a new entry at the slot returned by locate, the run behind it is shifted by one slot
+		 * @param entry built by the caller, so its key and value may have been copied from an entry of the table
+		 * @return false if a probe distance would overflow the metadata, nothing is changed then
+		 */
+		static bool insert(Entry* entries, unsigned char* probes, rsl::size_t mask, rsl::size_t slot, unsigned char probe,
+		                   Entry&& entry) {
+			if (probe == MAX_PROBE)
+				return false;
+			rsl::size_t last = slot;
+			while (probes[last] != EMPTY) {
+				if (probes[last] == MAX_PROBE - 1)
+					return false;
+				last = (last + 1) & mask;
+			}
+			for (; last != slot; last = (last - 1) & mask) {
+				rsl::size_t previous = (last - 1) & mask;
+				new(entries + last) Entry{std::move(entries[previous])};
+				entries[previous].~Entry();
+				probes[last] = static_cast<unsigned char>(probes[previous] + 1);
+			}
+			new(entries + slot) Entry{std::move(entry)};
+			probes[slot] = probe;
+			return true;
+		}
+
+		/**
+		 * @usage destroy the entry at slot and shift back the following entries that are not at their home slot
+		 */
+		static void erase(Entry* entries, unsigned char* probes, rsl::size_t mask, rsl::size_t slot) {
+			entries[slot].~Entry();
+			rsl::size_t next = (slot + 1) & mask;
+			while (probes[next] > 1) {
+				new(entries + slot) Entry{std::move(entries[next])};
+				entries[next].~Entry();
+				probes[slot] = static_cast<unsigned char>(probes[next] - 1);
+				slot = next;
+				next = (next + 1) & mask;
+			}
+			probes[slot] = EMPTY;
+		}
+
+		/**
+		 * @usage destroy every entry and mark all slots empty
+		 */
+		static void clear(Entry* entries, unsigned char* probes, rsl::size_t storageCapacity) {
+			for (rsl::size_t slot = 0; slot < storageCapacity; ++slot) {
+				if (probes[slot] != EMPTY) {
+					entries[slot].~Entry();
+					probes[slot] = EMPTY;
+				}
+			}
+		}
+	};
+
+	/**
+	 * @usage forward iterator over the occupied slots of a hash map, yields HashMapEntry with key and value
+	 */
+	template<typename K, typename V>
+	class RSL_UNUSED HashMapIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = HashMapEntry<K, V>;
+		using pointer = value_type*;
+		using reference = value_type&;
+
+		HashMapIterator(value_type* entries, const unsigned char* probes, rsl::size_t slot, rsl::size_t storageCapacity)
+				: entries(entries), probes(probes), slot(slot), storageCapacity(storageCapacity) {
+			skipEmpty();
+		}
+
+		reference operator*() const { return entries[slot]; }
+
+		pointer operator->() const { return entries + slot; }
+
+		HashMapIterator& operator++() {
+			++slot;
+			skipEmpty();
+			return *this;
+		}
+
+		HashMapIterator operator++(int) {
+			HashMapIterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		bool operator==(const HashMapIterator& other) const { return slot == other.slot && entries == other.entries; }
+
+		bool operator!=(const HashMapIterator& other) const { return !(*this == other); }
+
+	private:
+		value_type* entries;
+		const unsigned char* probes;
+		rsl::size_t slot;
+		rsl::size_t storageCapacity;
+
+		void skipEmpty() {
+			while (slot < storageCapacity && probes[slot] == 0)
+				++slot;
+		}
+	};
+}
+
+#endif //RSL_HASHMAP_HPP
@@ -0,0 +1,478 @@
+//
+// Created by robcholz on 11/19/23.
+//
+#pragma once
+
+#ifndef RSL_INTRUSIVELIST_HPP
+#define RSL_INTRUSIVELIST_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	template<typename T, typename TAG>
+	class IntrusiveList;
+
+	/**
+	 * @usage link hook of IntrusiveList, inherit it to make a type linkable. an object can be on one list per hook,
+	 * inherit hooks with different tags to put it on several lists at once
+	 * @tparam TAG any type, tells apart the hooks of one object
+	 * @attention copying an object does not copy its links, the copy starts unlinked
+	 */
+	template<typename TAG = void>
+	class RSL_UNUSED IntrusiveListHook {
+	public:
+		IntrusiveListHook() = default;
+
+		IntrusiveListHook(const IntrusiveListHook&) {}
+
+		IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+		/**
+		 * @usage check if the object is on a list through this hook
+		 * @return true if linked
+		 */
+		RSL_NODISCARD bool isLinked() const { return next != nullptr; }
+
+	private:
+		IntrusiveListHook* prev{nullptr};
+		IntrusiveListHook* next{nullptr};
+
+		template<typename, typename>
+		friend class IntrusiveList;
+	};
+
+	/**
+	 * @usage A doubly linked list over objects that embed their own links, adding, removing and splicing never
+	 * allocate and never copy the element
+	 * @tparam T element type, must inherit IntrusiveListHook<TAG>
+	 * @tparam TAG tag of the hook this list links through
+	 * @attention the list does not own its elements. an element has to be removed before it is destroyed or moved,
+	 * and must not be added while it is linked
+	 */
+	template<typename T, typename TAG = void>
+	class RSL_UNUSED IntrusiveList {
+	private:
+		using Hook = IntrusiveListHook<TAG>;
+	public:
+		/**
+		 * @usage construct an empty list
+		 */
+		IntrusiveList();
+
+		IntrusiveList(const IntrusiveList& other) = delete;
+
+		/**
+		 * @usage take over the elements of other
+		 * @param other instance, left empty
+		 */
+		IntrusiveList(IntrusiveList&& other) noexcept;
+
+		/**
+		 * @usage unlink every element, the elements themselves are untouched
+		 */
+		~IntrusiveList();
+
+		IntrusiveList& operator=(const IntrusiveList& other) = delete;
+
+		/**
+		 * @usage unlink the own elements and take over the elements of other
+		 * @param other instance, left empty
+		 * @return this instance
+		 */
+		IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+		/**
+		 * @usage link an element at the front of the list
+		 * @param element
+		 * @attention operation will be ignored if the element is already linked
+		 */
+		RSL_UNUSED void addFront(T& element);
+
+		/**
+		 * @usage link an element at the end of the list
+		 * @param element
+		 * @attention operation will be ignored if the element is already linked
+		 */
+		RSL_UNUSED void addBack(T& element);
+
+		/**
+		 * @usage splice every element of list to the front of the list, constant time
+		 * @param list left empty
+		 */
+		RSL_UNUSED void appendFront(IntrusiveList& list);
+
+		/**
+		 * @usage splice every element of list to the end of the list, constant time
+		 * @param list left empty
+		 */
+		RSL_UNUSED void appendBack(IntrusiveList& list);
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		RSL_UNUSED void popFront();
+
+		RSL_UNUSED void popBack();
+
+		/**
+		 * @usage unlink the element, constant time
+		 * @param element element linked to this list
+		 * @return false if the element is not linked
+		 */
+		RSL_UNUSED bool remove(T& element);
+
+		/**
+		 * @usage unlink every element
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage check if the list is empty
+		 * @return true if empty
+		 */
+		RSL_NODISCARD bool isEmpty() const;
+
+		/**
+		 * @usage check if an element is contained in the list, compares by address
+		 * @param element
+		 * @return true if the given element is linked to this list
+		 */
+		RSL_UNUSED bool contains(const T& element) const;
+
+		/**
+		 * @usage get the length of the list
+		 * @return the length of the list
+		 */
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @usage print the list
+		 */
+		RSL_UNUSED void print() const;
+
+	private:
+		Hook root; // sentinel, root.next is the front and root.prev the back
+		rsl::size_t size{};
+		inline static T defaultValue{};
+
+		class RSL_UNUSED Iterator {
+		private:
+			Hook* current;
+
+		public:
+			using iterator_category RSL_UNUSED = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			RSL_UNUSED
+			explicit Iterator(Hook* current) : current(current) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return current != other.current;
+			}
+
+			reference operator*() const {
+				return IntrusiveList::element(current);
+			}
+
+			pointer operator->() const {
+				return &IntrusiveList::element(current);
+			}
+
+			Iterator& operator++() {
+				current = current->next;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			Iterator& operator--() {
+				current = current->prev;
+				return *this;
+			}
+
+			Iterator operator--(int) {
+				Iterator temp = *this;
+				--(*this);
+				return temp;
+			}
+
+			friend class IntrusiveList;
+		};
+
+		static T& element(Hook* hook);
+
+		static Hook* hookOf(const T& element);
+
+		void link(Hook* before, Hook* hook);
+
+		void unlink(Hook* hook);
+
+		void take(IntrusiveList& other);
+
+	public:
+		/**
+		 * @usage link an element before position
+		 * @param position
+		 * @param element
+		 * @attention operation will be ignored if the element is already linked
+		 */
+		RSL_UNUSED void insert(Iterator position, T& element);
+
+		/**
+		 * @usage iterator func
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+	};
+
+	template<typename T, typename TAG>
+	IntrusiveList<T, TAG>::IntrusiveList() {
+		root.prev = &root;
+		root.next = &root;
+	}
+
+	template<typename T, typename TAG>
+	IntrusiveList<T, TAG>::IntrusiveList(IntrusiveList&& other) noexcept {
+		root.prev = &root;
+		root.next = &root;
+		take(other);
+	}
+
+	template<typename T, typename TAG>
+	IntrusiveList<T, TAG>::~IntrusiveList() {
+		empty();
+	}
+
+	template<typename T, typename TAG>
+	IntrusiveList<T, TAG>& IntrusiveList<T, TAG>::operator=(IntrusiveList&& other) noexcept {
+		if (this != &other) {
+			empty();
+			take(other);
+		}
+		return *this;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::addFront(T& element) {
+		Hook* hook = hookOf(element);
+		RSL_RUNTIME_BOUND_CHECK_ARG(hook->isLinked(), "Element is already linked, add failed", return;);
+		link(root.next, hook);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::addBack(T& element) {
+		Hook* hook = hookOf(element);
+		RSL_RUNTIME_BOUND_CHECK_ARG(hook->isLinked(), "Element is already linked, add failed", return;);
+		link(&root, hook);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::insert(Iterator position, T& element) {
+		Hook* hook = hookOf(element);
+		RSL_RUNTIME_BOUND_CHECK_ARG(hook->isLinked(), "Element is already linked, insert failed", return;);
+		link(position.current, hook);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::appendFront(IntrusiveList& list) {
+		if (&list == this || list.isEmpty())
+			return;
+		Hook* first = list.root.next;
+		Hook* last = list.root.prev;
+		last->next = root.next;
+		root.next->prev = last;
+		root.next = first;
+		first->prev = &root;
+		size += list.size;
+		list.root.prev = &list.root;
+		list.root.next = &list.root;
+		list.size = 0;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::appendBack(IntrusiveList& list) {
+		if (&list == this || list.isEmpty())
+			return;
+		Hook* first = list.root.next;
+		Hook* last = list.root.prev;
+		first->prev = root.prev;
+		root.prev->next = first;
+		root.prev = last;
+		last->next = &root;
+		size += list.size;
+		list.root.prev = &list.root;
+		list.root.next = &list.root;
+		list.size = 0;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	T& IntrusiveList<T, TAG>::front() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "List is empty", return defaultValue;);
+		return element(root.next);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	T& IntrusiveList<T, TAG>::back() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "List is empty", return defaultValue;);
+		return element(root.prev);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::popFront() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "List is empty, pop failed", return;);
+		unlink(root.next);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::popBack() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "List is empty, pop failed", return;);
+		unlink(root.prev);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	bool IntrusiveList<T, TAG>::remove(T& element) {
+		Hook* hook = hookOf(element);
+		if (!hook->isLinked())
+			return false;
+		unlink(hook);
+		return true;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::empty() {
+		Hook* hook = root.next;
+		while (hook != &root) {
+			Hook* next = hook->next;
+			hook->prev = nullptr;
+			hook->next = nullptr;
+			hook = next;
+		}
+		root.prev = &root;
+		root.next = &root;
+		size = 0;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	bool IntrusiveList<T, TAG>::isEmpty() const {
+		return size == 0;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	bool IntrusiveList<T, TAG>::contains(const T& element) const {
+		const Hook* hook = hookOf(element);
+		for (const Hook* current = root.next; current != &root; current = current->next) {
+			if (current == hook)
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	rsl::size_t IntrusiveList<T, TAG>::length() const {
+		return size;
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	void IntrusiveList<T, TAG>::print() const {
+		rsl::size_t i = 0;
+		RSL_PRINT("IntrusiveList[");
+		for (const auto& element: *this) {
+			RSL_PRINT(element);
+			++i;
+			if (i < size) {
+				RSL_PRINT(",");
+			}
+		}
+		RSL_PRINT("]");
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	typename IntrusiveList<T, TAG>::Iterator IntrusiveList<T, TAG>::begin() const {
+		return Iterator(root.next);
+	}
+
+	template<typename T, typename TAG>
+	RSL_UNUSED
+	typename IntrusiveList<T, TAG>::Iterator IntrusiveList<T, TAG>::end() const {
+		return Iterator(const_cast<Hook*>(&root));
+	}
+
+	template<typename T, typename TAG>
+	T& IntrusiveList<T, TAG>::element(Hook* hook) {
+		return static_cast<T&>(*hook);
+	}
+
+	template<typename T, typename TAG>
+	typename IntrusiveList<T, TAG>::Hook* IntrusiveList<T, TAG>::hookOf(const T& element) {
+		return const_cast<Hook*>(static_cast<const Hook*>(&element));
+	}
+
+	template<typename T, typename TAG>
+	void IntrusiveList<T, TAG>::link(Hook* before, Hook* hook) {
+		hook->next = before;
+		hook->prev = before->prev;
+		before->prev->next = hook;
+		before->prev = hook;
+		++size;
+	}
+
+	template<typename T, typename TAG>
+	void IntrusiveList<T, TAG>::unlink(Hook* hook) {
+		hook->prev->next = hook->next;
+		hook->next->prev = hook->prev;
+		hook->prev = nullptr;
+		hook->next = nullptr;
+		--size;
+	}
+
+	template<typename T, typename TAG>
+	void IntrusiveList<T, TAG>::take(IntrusiveList& other) {
+		if (other.isEmpty())
+			return;
+		root.next = other.root.next;
+		root.prev = other.root.prev;
+		root.next->prev = &root;
+		root.prev->next = &root;
+		size = other.size;
+		other.root.prev = &other.root;
+		other.root.next = &other.root;
+		other.size = 0;
+	}
+}
+
+#endif //RSL_INTRUSIVELIST_HPP
@@ -0,0 +1,676 @@
+//
+// Created by robcholz on 11/21/23.
+//
+#pragma once
+
+#ifndef RSL_SEGMENTEDBUFFER_HPP
+#define RSL_SEGMENTEDBUFFER_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include <memory/ByteAllocator.hpp>
+#include <memory/SlabAllocator.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage raw storage of one block of a SegmentedBuffer
+	 */
+	template<typename T, rsl::size_t BLOCK_CAPACITY>
+	struct SegmentBlock {
+		alignas(T) unsigned char storage[sizeof(T) * BLOCK_CAPACITY];
+	};
+
+	/**
+	 * @usage default number of elements per block, about 512 bytes and at least 16 elements
+	 */
+	template<typename T>
+	constexpr rsl::size_t segmentBlockCapacity() {
+		return rsl::nextPowerOfTwo(sizeof(T) < 32 ? 512 / sizeof(T) : 16);
+	}
+
+	/**
+	 * @usage A heap-allocated buffer made of fixed-size blocks chained through a block map, with O(1) add and pop at
+	 * both ends. growing only adds a block and at times copies the block map, the elements are never moved, so
+	 * references to them stay valid until they are popped
+	 * @tparam T element type
+	 * @tparam DEFAULT_CAPACITY sizes the block map allocated by the first add, blocks are allocated on demand
+	 * @tparam BLOCK_CAPACITY number of elements per block
+	 * @tparam ALLOCATOR block allocator, the default pools blocks in chunks instead of calling malloc per block
+	 */
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, rsl::size_t BLOCK_CAPACITY = segmentBlockCapacity<T>(),
+			typename ALLOCATOR=SlabAllocator<SegmentBlock<T, BLOCK_CAPACITY>>>
+	class RSL_UNUSED SegmentedBuffer {
+	public:
+		/**
+		 * @usage construct an empty buffer, nothing is allocated until the first add
+		 */
+		SegmentedBuffer() = default;
+
+		/**
+		 * @usage construct with arguments
+		 * @tparam Args type that matches T
+		 * @param args parameter list
+		 */
+		template<typename... Args>
+		explicit SegmentedBuffer(const Args& ... args);
+
+		SegmentedBuffer(const SegmentedBuffer& other);
+
+		/**
+		 * @usage take over the blocks of other together with its allocator, no element is copied or moved
+		 * @param other instance, left empty
+		 */
+		SegmentedBuffer(SegmentedBuffer&& other) noexcept;
+
+		/**
+		 * @usage destroy the elements and give back every block
+		 */
+		~SegmentedBuffer();
+
+		SegmentedBuffer& operator=(const SegmentedBuffer& other);
+
+		/**
+		 * @usage release the own blocks and take over the blocks of other together with its allocator
+		 * @param other instance, left empty
+		 * @return this instance
+		 */
+		SegmentedBuffer& operator=(SegmentedBuffer&& other) noexcept;
+
+		/**
+		 * @usage compare the contents of two buffers
+		 * @param other instance
+		 * @return ture if two buffers are same in contents
+		 */
+		template<rsl::size_t CAPACITY_>
+		bool operator==(const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const;
+
+		template<rsl::size_t CAPACITY_>
+		bool operator>(const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const;
+
+		template<rsl::size_t CAPACITY_>
+		bool operator<(const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const;
+
+		/**
+		 * @usage get the reference of the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the reference of the element at the given index, default value if out of bound
+		 */
+		T& operator[](rsl::size_t index);
+
+		T operator[](rsl::size_t index) const;
+
+		RSL_UNUSED void addFront(const T& element);
+
+		RSL_UNUSED void addFront(T&& element);
+
+		RSL_UNUSED void addBack(const T& element);
+
+		RSL_UNUSED void addBack(T&& element);
+
+		/**
+		 * @usage construct an element in place at the front of the buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if no block can be allocated
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if no block can be allocated
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		RSL_UNUSED void popFront();
+
+		RSL_UNUSED void popBack();
+
+		/**
+		 * @usage destroy every element, one block is kept for the next add
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage give back the blocks that hold no element and shrink the block map to the blocks in use
+		 */
+		RSL_UNUSED void trimToSize();
+
+		/**
+		 * @usage size the block map for at least capacity elements, so growing up to it never copies the map.
+		 * blocks are still allocated on demand
+		 * @param capacity
+		 */
+		RSL_UNUSED void capacity(rsl::size_t capacity);
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_UNUSED bool contains(const T& element) const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @usage get the capacity, elements the allocated blocks can hold
+		 * @return capacity
+		 */
+		RSL_NODISCARD rsl::size_t capacity() const;
+
+		RSL_UNUSED T& get(rsl::size_t index);
+
+		RSL_UNUSED T get(rsl::size_t index) const;
+
+		RSL_UNUSED void print() const;
+
+	private:
+		T** blockMap{nullptr};
+		rsl::size_t mapCapacity{0};
+		rsl::size_t firstBlock{0}; // index of the front block in the block map
+		rsl::size_t blockCount{0};
+		rsl::size_t head{0}; // slot of the front element in the front block
+		rsl::size_t size{0};
+		ALLOCATOR allocator;
+		ByteAllocator<T*> mapAllocator;
+		inline static T defaultValue{};
+
+		RSL_COMPILETIME_BOUND_CHECK(BLOCK_CAPACITY > 0, "Block capacity must be larger than 0.");
+
+		class RSL_UNUSED Iterator {
+		private:
+			T* const* block;
+			T* const* firstBlock;
+			T* const* lastBlock;
+			T* current;
+
+		public:
+			using iterator_category RSL_UNUSED = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			Iterator() : block(nullptr), firstBlock(nullptr), lastBlock(nullptr), current(nullptr) {}
+
+			Iterator(T* const* block, T* const* firstBlock, T* const* lastBlock, T* current)
+					: block(block), firstBlock(firstBlock), lastBlock(lastBlock), current(current) {}
+
+			// one past a full block may be the address of the next block in memory, so the block is compared too
+			bool operator==(const Iterator& other) const {
+				return current == other.current && block == other.block;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			pointer operator->() const {
+				return current;
+			}
+
+			Iterator& operator++() {
+				++current;
+				// the end iterator stays one past the last slot of the last block
+				if (current == *block + BLOCK_CAPACITY && block != lastBlock) {
+					++block;
+					current = *block;
+				}
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			Iterator& operator--() {
+				if (current == *block && block != firstBlock) {
+					--block;
+					current = *block + BLOCK_CAPACITY;
+				}
+				--current;
+				return *this;
+			}
+
+			Iterator operator--(int) {
+				Iterator temp = *this;
+				--(*this);
+				return temp;
+			}
+		};
+
+		T* slot(rsl::size_t index) const;
+
+		bool addBlock(bool atFront);
+
+		void freeBlock(T* block);
+
+		bool growMap(bool atFront);
+
+		bool reallocateMap(rsl::size_t capacity, rsl::size_t first);
+
+		void release();
+
+		template<typename Arg, typename... Args>
+		void addVariadic(const Arg& arg, const Args& ... args);
+
+		void addVariadic();
+
+	public:
+		/**
+		 * @usage iterator func
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+	};
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::SegmentedBuffer(const Args& ... args) {
+		(addVariadic((args)...));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::SegmentedBuffer(const SegmentedBuffer& other) {
+		for (const auto& element: other)
+			addBack(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::SegmentedBuffer(SegmentedBuffer&& other) noexcept
+			: blockMap(other.blockMap), mapCapacity(other.mapCapacity), firstBlock(other.firstBlock),
+			  blockCount(other.blockCount), head(other.head), size(other.size), allocator(std::move(other.allocator)),
+			  mapAllocator(std::move(other.mapAllocator)) {
+		other.blockMap = nullptr;
+		other.mapCapacity = 0;
+		other.firstBlock = 0;
+		other.blockCount = 0;
+		other.head = 0;
+		other.size = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::~SegmentedBuffer() {
+		release();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>&
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator=(const SegmentedBuffer& other) {
+		if (this == &other)
+			return *this;
+		empty();
+		for (const auto& element: other)
+			addBack(element);
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>&
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator=(SegmentedBuffer&& other) noexcept {
+		if (this == &other)
+			return *this;
+		release();
+		blockMap = other.blockMap;
+		mapCapacity = other.mapCapacity;
+		firstBlock = other.firstBlock;
+		blockCount = other.blockCount;
+		head = other.head;
+		size = other.size;
+		allocator = std::move(other.allocator);
+		mapAllocator = std::move(other.mapAllocator);
+		other.blockMap = nullptr;
+		other.mapCapacity = 0;
+		other.firstBlock = 0;
+		other.blockCount = 0;
+		other.head = 0;
+		other.size = 0;
+		return *this;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<rsl::size_t CAPACITY_>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator==(
+			const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const {
+		if (size != other.length())
+			return false;
+		auto otherElement = other.begin();
+		for (const auto& element: *this) {
+			if (element != *otherElement)
+				return false;
+			++otherElement;
+		}
+		return true;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<rsl::size_t CAPACITY_>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator>(
+			const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const {
+		return size > other.length();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<rsl::size_t CAPACITY_>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator<(
+			const SegmentedBuffer<T, CAPACITY_, BLOCK_CAPACITY, ALLOCATOR>& other) const {
+		return size < other.length();
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	T& SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator[](rsl::size_t index) {
+		return get(index);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	T SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::operator[](rsl::size_t index) const {
+		return get(index);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addFront(const T& element) {
+		emplaceFront(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addFront(T&& element) {
+		emplaceFront(std::move(element));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addBack(const T& element) {
+		emplaceBack(element);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addBack(T&& element) {
+		emplaceBack(std::move(element));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::emplaceFront(Args&& ... args) {
+		// adding a block never moves an element, args may safely refer to one
+		if (head == 0) {
+			if (size == 0 && blockCount != 0)
+				head = BLOCK_CAPACITY; // reuse the empty block pop kept, a block of one slot cannot be centred
+			else if (!addBlock(true))
+				return;
+		}
+		new(blockMap[firstBlock] + head - 1) T(std::forward<Args>(args)...);
+		--head;
+		++size;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<typename... Args>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::emplaceBack(Args&& ... args) {
+		if (head + size == blockCount * BLOCK_CAPACITY && !addBlock(false))
+			return;
+		new(slot(size)) T(std::forward<Args>(args)...);
+		++size;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::front() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "Buffer is empty", return defaultValue;);
+		return blockMap[firstBlock][head];
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::back() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "Buffer is empty", return defaultValue;);
+		return *slot(size - 1);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::popFront() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "Buffer is empty, popFront failed", return;);
+		blockMap[firstBlock][head].~T();
+		++head;
+		--size;
+		if (size == 0) {
+			// keep the last block, centred so the next add goes to either end without allocating
+			head = BLOCK_CAPACITY / 2;
+		} else if (head == BLOCK_CAPACITY) {
+			freeBlock(blockMap[firstBlock]);
+			++firstBlock;
+			--blockCount;
+			head = 0;
+		}
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::popBack() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(size == 0, "Buffer is empty, popBack failed", return;);
+		slot(size - 1)->~T();
+		--size;
+		if (size == 0) {
+			head = BLOCK_CAPACITY / 2;
+		} else if (head + size <= (blockCount - 1) * BLOCK_CAPACITY) {
+			freeBlock(blockMap[firstBlock + blockCount - 1]);
+			--blockCount;
+		}
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::empty() {
+		if (blockCount == 0)
+			return;
+		if constexpr (!std::is_trivially_destructible<T>::value) {
+			for (auto& element: *this)
+				element.~T();
+		}
+		for (rsl::size_t index = 1; index < blockCount; ++index)
+			freeBlock(blockMap[firstBlock + index]);
+		blockCount = 1;
+		head = BLOCK_CAPACITY / 2;
+		size = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::trimToSize() {
+		if (size == 0) {
+			release();
+			return;
+		}
+		if (mapCapacity > blockCount)
+			reallocateMap(blockCount, 0);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::capacity(rsl::size_t capacity) {
+		// one spare map slot at each end, the front block may be partly used
+		rsl::size_t blocks = (capacity + BLOCK_CAPACITY - 1) / BLOCK_CAPACITY + 2;
+		if (blocks > mapCapacity)
+			reallocateMap(blocks, (blocks - blockCount) / 2);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::isEmpty() const {
+		return size == 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::contains(const T& element) const {
+		for (const auto& current: *this) {
+			if (current == element)
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	rsl::size_t SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::length() const {
+		return size;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_NODISCARD
+	rsl::size_t SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::capacity() const {
+		return blockCount * BLOCK_CAPACITY;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T& SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::get(rsl::size_t index) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= size, "Index out of bound", return defaultValue;);
+		return *slot(index);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	T SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::get(rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= size, "Index out of bound", return defaultValue;);
+		return *slot(index);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	RSL_UNUSED
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::print() const {
+		rsl::size_t i = 0;
+		RSL_PRINT("SegmentedBuffer[");
+		for (const auto& element: *this) {
+			RSL_PRINT(element);
+			++i;
+			if (i < size) {
+				RSL_PRINT(",");
+			}
+		}
+		RSL_PRINT("]");
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	typename SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::Iterator
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::begin() const {
+		if (size == 0)
+			return Iterator();
+		T* const* first = blockMap + firstBlock;
+		return Iterator(first, first, first + blockCount - 1, *first + head);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	typename SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::Iterator
+	SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::end() const {
+		if (size == 0)
+			return Iterator();
+		T* const* first = blockMap + firstBlock;
+		T* const* last = first + blockCount - 1;
+		return Iterator(last, first, last, slot(size - 1) + 1);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	T* SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::slot(rsl::size_t index) const {
+		rsl::size_t position = head + index;
+		return blockMap[firstBlock + position / BLOCK_CAPACITY] + position % BLOCK_CAPACITY;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addBlock(bool atFront) {
+		if (atFront ? firstBlock == 0 : firstBlock + blockCount == mapCapacity) {
+			if (!growMap(atFront))
+				return false;
+		}
+		auto* block = allocator.malloc();
+		RSL_RUNTIME_BOUND_CHECK_ARG(block == nullptr, "Allocation failed, element is not added", return false;);
+		T* elements = reinterpret_cast<T*>(block->storage);
+		if (atFront) {
+			blockMap[--firstBlock] = elements;
+			head += BLOCK_CAPACITY;
+		} else {
+			blockMap[firstBlock + blockCount] = elements;
+		}
+		++blockCount;
+		return true;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::freeBlock(T* block) {
+		// the storage is the first member of the block, both have the same address
+		allocator.free(block);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::growMap(bool atFront) {
+		rsl::size_t needed = blockCount + 1;
+		if (needed * 2 <= mapCapacity) {
+			// plenty of room at the other end, centre the blocks instead of growing
+			rsl::size_t first = (mapCapacity - needed) / 2 + (atFront ? 1 : 0);
+			rsl::moveRange(blockMap + first, blockMap + firstBlock, blockCount);
+			firstBlock = first;
+			return true;
+		}
+		rsl::size_t capacity = rsl::max(rsl::max(mapCapacity * 2, needed * 2),
+		                                (DEFAULT_CAPACITY + BLOCK_CAPACITY - 1) / BLOCK_CAPACITY + 2);
+		return reallocateMap(capacity, (capacity - needed) / 2 + (atFront ? 1 : 0));
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	bool SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::reallocateMap(rsl::size_t capacity, rsl::size_t first) {
+		T** newMap = mapAllocator.malloc(sizeof(T*) * capacity);
+		RSL_RUNTIME_BOUND_CHECK_ARG(newMap == nullptr, "Allocation failed, block map is not resized", return false;);
+		if (blockCount != 0)
+			std::memcpy(newMap + first, blockMap + firstBlock, sizeof(T*) * blockCount);
+		mapAllocator.free(blockMap);
+		blockMap = newMap;
+		mapCapacity = capacity;
+		firstBlock = first;
+		return true;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::release() {
+		empty();
+		if (blockCount != 0)
+			freeBlock(blockMap[firstBlock]);
+		mapAllocator.free(blockMap);
+		blockMap = nullptr;
+		mapCapacity = 0;
+		firstBlock = 0;
+		blockCount = 0;
+		head = 0;
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	template<typename Arg, typename... Args>
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addVariadic(const Arg& arg, const Args& ... args) {
+		addBack(arg);
+		addVariadic(args...);
+	}
+
+	template<typename T, rsl::size_t DEFAULT_CAPACITY, rsl::size_t BLOCK_CAPACITY, typename ALLOCATOR>
+	void SegmentedBuffer<T, DEFAULT_CAPACITY, BLOCK_CAPACITY, ALLOCATOR>::addVariadic() {}
+}
+
+#endif //RSL_SEGMENTEDBUFFER_HPP
@@ -0,0 +1,468 @@
+//
+// Created by robcholz on 11/23/23.
+//
+#pragma once
+
+#ifndef RSL_SPAN_HPP
+#define RSL_SPAN_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage non-owning view of contiguous elements, e.g. the elements of a StaticArray or DynamicArray. it is two words
+	 * and is passed by value, nothing is copied
+	 * @tparam T element type, const T for a read-only view
+	 * @attention the view is invalidated by anything that moves the elements of the viewed container
+	 */
+	template<typename T>
+	class RSL_UNUSED Span {
+	public:
+		constexpr Span() = default;
+
+		/**
+		 * @usage view length elements starting at data
+		 * @param data
+		 * @param length
+		 */
+		constexpr Span(T* data, rsl::size_t length);
+
+		/**
+		 * @usage view a whole c array
+		 * @param array
+		 */
+		template<rsl::size_t N>
+		constexpr Span(T (& array)[N]); // NOLINT(google-explicit-constructor)
+
+		/**
+		 * @usage a view of T converts to a view of const T
+		 * @param other
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+		constexpr Span(const Span<U>& other); // NOLINT(google-explicit-constructor)
+
+		/**
+		 * @usage get the element at the given index. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the reference of the element, the default value of T if index out of bound
+		 */
+		T& operator[](rsl::size_t index) const;
+
+		RSL_UNUSED T& get(rsl::size_t index) const;
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		/**
+		 * @usage get the first count elements
+		 * @param count
+		 * @return the view, shortened to the length of the span if count is larger
+		 */
+		RSL_NODISCARD Span first(rsl::size_t count) const;
+
+		/**
+		 * @usage get the last count elements, e.g. the newest samples of a window
+		 * @param count
+		 * @return the view, shortened to the length of the span if count is larger
+		 */
+		RSL_NODISCARD Span last(rsl::size_t count) const;
+
+		/**
+		 * @usage get count elements starting at offset
+		 * @param offset
+		 * @param count
+		 * @return the view, shortened to the end of the span
+		 */
+		RSL_NODISCARD Span subSpan(rsl::size_t offset, rsl::size_t count) const;
+
+		RSL_NODISCARD T* data() const;
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		RSL_UNUSED void print() const;
+
+		T* begin() const;
+
+		T* end() const;
+
+	private:
+		T* elements{nullptr};
+		rsl::size_t elementsLength{0};
+		inline static typename std::remove_const<T>::type defaultValue{};
+	};
+
+	/**
+	 * @usage non-owning view of elements stored in two contiguous segments, the way a ring buffer wraps around its
+	 * storage. loops over it are two tight loops over firstSpan() and secondSpan()
+	 * @tparam T element type, const T for a read-only view
+	 * @attention the view is invalidated by anything that moves the elements of the viewed container
+	 */
+	template<typename T>
+	class RSL_UNUSED RingSpan {
+	public:
+		constexpr RingSpan() = default;
+
+		/**
+		 * @usage view first followed by second
+		 * @param first
+		 * @param second
+		 */
+		RingSpan(const Span<T>& first, const Span<T>& second);
+
+		/**
+		 * @usage view a single segment, so code taking a RingSpan also takes the span of an array
+		 * @param span
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+		RingSpan(const Span<U>& span); // NOLINT(google-explicit-constructor)
+
+		/**
+		 * @usage a view of T converts to a view of const T
+		 * @param other
+		 */
+		template<typename U, typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+		RingSpan(const RingSpan<U>& other); // NOLINT(google-explicit-constructor)
+
+		/**
+		 * @usage get the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the reference of the element, the default value of T if index out of bound
+		 */
+		T& operator[](rsl::size_t index) const;
+
+		RSL_UNUSED T& get(rsl::size_t index) const;
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		/**
+		 * @usage get the first count elements
+		 * @param count
+		 * @return the view, shortened to the length of the span if count is larger
+		 */
+		RSL_NODISCARD RingSpan first(rsl::size_t count) const;
+
+		/**
+		 * @usage get the last count elements, e.g. the newest samples of a window
+		 * @param count
+		 * @return the view, shortened to the length of the span if count is larger
+		 */
+		RSL_NODISCARD RingSpan last(rsl::size_t count) const;
+
+		/**
+		 * @usage get the segment that holds the front element
+		 * @return the first segment, empty only if the whole view is empty
+		 */
+		RSL_NODISCARD const Span<T>& firstSpan() const;
+
+		/**
+		 * @usage get the segment that follows the first one
+		 * @return the second segment, empty if the elements do not wrap
+		 */
+		RSL_NODISCARD const Span<T>& secondSpan() const;
+
+		/**
+		 * @usage copy the elements into contiguous storage
+		 * @param destination room for length() live objects
+		 */
+		RSL_UNUSED void copyTo(typename std::remove_const<T>::type* destination) const;
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		RSL_UNUSED void print() const;
+
+	private:
+		Span<T> firstSegment;
+		Span<T> secondSegment;
+		inline static typename std::remove_const<T>::type defaultValue{};
+
+		class RSL_UNUSED Iterator {
+		private:
+			T* current;
+			T* firstEnd;
+			T* secondBegin;
+			// a full ring ends where it begins, so the pointer alone does not tell begin from end
+			bool inSecond;
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using value_type = typename std::remove_const<T>::type;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			Iterator(pointer current, pointer firstEnd, pointer secondBegin, bool inSecond)
+					: current(current), firstEnd(firstEnd), secondBegin(secondBegin), inSecond(inSecond) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current && inSecond == other.inSecond;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			pointer operator->() const {
+				return current;
+			}
+
+			Iterator& operator++() {
+				++current;
+				if (current == firstEnd && !inSecond && secondBegin != nullptr) {
+					current = secondBegin;
+					inSecond = true;
+				}
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		/**
+		 * @usage iterator func
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+	};
+
+	template<typename T>
+	constexpr Span<T>::Span(T* data, rsl::size_t length) : elements(data), elementsLength(length) {}
+
+	template<typename T>
+	template<rsl::size_t N>
+	constexpr Span<T>::Span(T (& array)[N]) : elements(array), elementsLength(N) {}
+
+	template<typename T>
+	template<typename U, typename>
+	constexpr Span<T>::Span(const Span<U>& other) : elements(other.data()), elementsLength(other.length()) {}
+
+	template<typename T>
+	T& Span<T>::operator[](rsl::size_t index) const {
+		return get(index);
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& Span<T>::get(rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= elementsLength, "Index out of bound", return defaultValue;);
+		return elements[index];
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& Span<T>::front() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(elementsLength == 0, "Span is empty", return defaultValue;);
+		return elements[0];
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& Span<T>::back() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(elementsLength == 0, "Span is empty", return defaultValue;);
+		return elements[elementsLength - 1];
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	Span<T> Span<T>::first(rsl::size_t count) const {
+		return Span(elements, rsl::min(count, elementsLength));
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	Span<T> Span<T>::last(rsl::size_t count) const {
+		count = rsl::min(count, elementsLength);
+		return Span(elements + elementsLength - count, count);
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	Span<T> Span<T>::subSpan(rsl::size_t offset, rsl::size_t count) const {
+		offset = rsl::min(offset, elementsLength);
+		return Span(elements + offset, rsl::min(count, elementsLength - offset));
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	T* Span<T>::data() const {
+		return elements;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	bool Span<T>::isEmpty() const {
+		return elementsLength == 0;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	rsl::size_t Span<T>::length() const {
+		return elementsLength;
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	void Span<T>::print() const {
+		RSL_PRINT("Span[");
+		for (rsl::size_t i = 0; i < elementsLength; ++i) {
+			RSL_PRINT(elements[i]);
+			if (i < elementsLength - 1) {
+				RSL_PRINT(", ");
+			}
+		}
+		RSL_PRINTF("]");
+	}
+
+	template<typename T>
+	T* Span<T>::begin() const {
+		return elements;
+	}
+
+	template<typename T>
+	T* Span<T>::end() const {
+		return elements + elementsLength;
+	}
+
+	template<typename T>
+	RingSpan<T>::RingSpan(const Span<T>& first, const Span<T>& second) : firstSegment(first), secondSegment(second) {
+		// keep the front element in the first segment
+		if (firstSegment.isEmpty()) {
+			firstSegment = secondSegment;
+			secondSegment = Span<T>();
+		}
+		// an empty second segment has no pointer, the iterator relies on it
+		if (secondSegment.isEmpty())
+			secondSegment = Span<T>();
+	}
+
+	template<typename T>
+	template<typename U, typename>
+	RingSpan<T>::RingSpan(const Span<U>& span) : firstSegment(span) {}
+
+	template<typename T>
+	template<typename U, typename>
+	RingSpan<T>::RingSpan(const RingSpan<U>& other) : firstSegment(other.firstSpan()), secondSegment(other.secondSpan()) {}
+
+	template<typename T>
+	T& RingSpan<T>::operator[](rsl::size_t index) const {
+		return get(index);
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& RingSpan<T>::get(rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= length(), "Index out of bound", return defaultValue;);
+		if (index < firstSegment.length())
+			return firstSegment.data()[index];
+		return secondSegment.data()[index - firstSegment.length()];
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& RingSpan<T>::front() const {
+		return firstSegment.front();
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T& RingSpan<T>::back() const {
+		return secondSegment.isEmpty() ? firstSegment.back() : secondSegment.back();
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	RingSpan<T> RingSpan<T>::first(rsl::size_t count) const {
+		if (count <= firstSegment.length())
+			return RingSpan(firstSegment.first(count), Span<T>());
+		return RingSpan(firstSegment, secondSegment.first(count - firstSegment.length()));
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	RingSpan<T> RingSpan<T>::last(rsl::size_t count) const {
+		if (count <= secondSegment.length())
+			return RingSpan(secondSegment.last(count), Span<T>());
+		return RingSpan(firstSegment.last(count - secondSegment.length()), secondSegment);
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	const Span<T>& RingSpan<T>::firstSpan() const {
+		return firstSegment;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	const Span<T>& RingSpan<T>::secondSpan() const {
+		return secondSegment;
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	void RingSpan<T>::copyTo(typename std::remove_const<T>::type* destination) const {
+		rsl::copyRange(destination, firstSegment.data(), firstSegment.length());
+		rsl::copyRange(destination + firstSegment.length(), secondSegment.data(), secondSegment.length());
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	bool RingSpan<T>::isEmpty() const {
+		return firstSegment.isEmpty();
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	rsl::size_t RingSpan<T>::length() const {
+		return firstSegment.length() + secondSegment.length();
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	void RingSpan<T>::print() const {
+		RSL_PRINT("RingSpan[");
+		for (rsl::size_t i = 0; i < length(); ++i) {
+			RSL_PRINT(get(i));
+			if (i < length() - 1) {
+				RSL_PRINT(", ");
+			}
+		}
+		RSL_PRINTF("]");
+	}
+
+	template<typename T>
+	typename RingSpan<T>::Iterator RingSpan<T>::begin() const {
+		return Iterator(firstSegment.begin(), firstSegment.end(), secondSegment.data(), false);
+	}
+
+	template<typename T>
+	typename RingSpan<T>::Iterator RingSpan<T>::end() const {
+		if (secondSegment.isEmpty())
+			return Iterator(firstSegment.end(), firstSegment.end(), nullptr, false);
+		return Iterator(secondSegment.end(), firstSegment.end(), secondSegment.data(), true);
+	}
+}
+
+#endif //RSL_SPAN_HPP
@@ -7,6 +7,8 @@
 #define RSL_STATICARRAY_HPP
 
 #include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "Span.hpp"
 
 
 namespace rsl {
@@ -50,10 +52,10 @@ namespace rsl {
 		StaticArray& operator=(const StaticArray<T, CAPACITY_>& other);
 
 		/**
-		 * @usage move constructor
-		 * @param other instance
+		 * @usage move assignment, the elements are moved one by one since they live inside the array
+		 * @param other instance, left empty
 		 * @return new instance
-		 * @attention if the length of the copied array is larger than the capacity of the array copied to, the array will be filled
+		 * @attention if the length of the moved array is larger than the capacity of the array moved to, the array will be filled
 		 */
 		template<rsl::size_t CAPACITY_>
 		StaticArray& operator=(StaticArray<T, CAPACITY_>&& other) noexcept;
@@ -103,6 +105,8 @@ namespace rsl {
 
 		RSL_UNUSED void addFront(const T& element);
 
+		RSL_UNUSED void addFront(T&& element);
+
 		/**
 		 * @usage addBack an element to the end of the array
 		 * @param element
@@ -110,6 +114,8 @@ namespace rsl {
 		 */
 		RSL_UNUSED void addBack(const T& element);
 
+		RSL_UNUSED void addBack(T&& element);
+
 		/**
 		 * @usage addBack the element at the given index of the array
 		 * @param index
@@ -118,6 +124,33 @@ namespace rsl {
 		 */
 		RSL_UNUSED void add(rsl::size_t index, const T& element);
 
+		RSL_UNUSED void add(rsl::size_t index, T&& element);
+
+		/**
+		 * @usage construct an element at the front of the array
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if array is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the array
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if array is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
+		/**
+		 * @usage construct an element at the given index of the array
+		 * @param index
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if array is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplace(rsl::size_t index, Args&& ... args);
+
 		/**
 		  * @usage append another array to the end of the array
 		  * @param array
@@ -134,6 +167,24 @@ namespace rsl {
 		template<rsl::size_t CAPACITY_>
 		RSL_UNUSED void appendBack(const StaticArray<T, CAPACITY_>& array);
 
+		/**
+		 * @usage append the elements of a view to the end of the array, e.g. the span of an array of another type
+		 * @tparam U T or const T
+		 * @param span
+		 * @attention operation will be ignored if array is full
+		 */
+		template<typename U>
+		RSL_UNUSED void appendBack(const Span<U>& span);
+
+		/**
+		 * @usage append the elements of a ring view, e.g. the window of a pipeline, to the end of the array
+		 * @tparam U T or const T
+		 * @param span
+		 * @attention operation will be ignored if array is full, the view must not point into this array
+		 */
+		template<typename U>
+		RSL_UNUSED void appendBack(const RingSpan<U>& span);
+
 		/**
 		 * @usage append another array at the given index of the array
 		 * @param index
@@ -143,6 +194,17 @@ namespace rsl {
 		template<rsl::size_t CAPACITY_>
 		RSL_UNUSED void append(rsl::size_t index, const StaticArray<T, CAPACITY_>& array);
 
+		/**
+		 * @usage insert the elements of [first, last) at the given index, the tail of the array is shifted only once
+		 * @tparam ITERATOR iterator whose elements are assignable to T
+		 * @param index
+		 * @param first
+		 * @param last
+		 * @attention operation will be ignored if array is full, the range must not point into this array
+		 */
+		template<typename ITERATOR>
+		RSL_UNUSED void insert(rsl::size_t index, ITERATOR first, ITERATOR last);
+
 		RSL_UNUSED T& front() const;
 
 		RSL_UNUSED T& back() const;
@@ -246,15 +308,23 @@ namespace rsl {
 		 */
 		RSL_UNUSED const T* getRowArray() const;
 
+		/**
+		 * @usage get a view of the elements, nothing is copied
+		 * @return the view, invalidated by anything that adds or removes elements
+		 */
+		RSL_NODISCARD Span<T> span();
+
+		RSL_NODISCARD Span<const T> span() const;
+
 		/**
 		 * @usage print the array
 		 */
 		RSL_UNUSED void print() const;
 
 	private:
-		T container[DEFAULT_CAPACITY]; // row array
+		T container[DEFAULT_CAPACITY]{}; // row array
 		rsl::size_t containerLength{}; // the current length of the array
-		inline static T defaultValue{0};
+		inline static T defaultValue{};
 
 		class RSL_UNUSED Iterator {
 		private:
@@ -291,9 +361,8 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator++(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator++(int) {
+				Iterator temp = *this;
 				++(*this);
 				return temp;
 			}
@@ -303,9 +372,8 @@ namespace rsl {
 				return *this;
 			}
 
-			Iterator& operator--(int) {
-				static Iterator temp;
-				temp = *this;
+			Iterator operator--(int) {
+				Iterator temp = *this;
 				--(*this);
 				return temp;
 			}
@@ -347,15 +415,10 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	StaticArray<T, CAPACITY>::StaticArray(const StaticArray<T, CAPACITY_>& other) {
-		static rsl::size_t otherLength = other.length();
-		static const T* otherContainer = other.getRowArray();
-		containerLength = otherLength;
-		RSL_RUNTIME_BOUND_CHECK_ARG(otherLength > CAPACITY, "Assignment failed! Capacity is too small.",
+		containerLength = other.length();
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength > CAPACITY, "Assignment failed! Capacity is too small.",
 		                            containerLength = CAPACITY;);
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
-		}
+		rsl::copyRange(container, other.getRowArray(), containerLength);
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -363,17 +426,12 @@ namespace rsl {
 	RSL_UNUSED
 	StaticArray<T, CAPACITY>& StaticArray<T, CAPACITY>::operator=(const StaticArray<T, CAPACITY_>& other) {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
-		static rsl::size_t otherLength = other.length();
-		static const T* otherContainer = other.getRowArray();
-		containerLength = otherLength;
-		RSL_RUNTIME_BOUND_CHECK_ARG(otherLength > CAPACITY, "Assignment failed! Capacity is too small.",
+		containerLength = other.length();
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength > CAPACITY, "Assignment failed! Capacity is too small.",
 		                            containerLength = CAPACITY;);
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
-		}
+		rsl::copyRange(container, other.getRowArray(), containerLength);
 		return *this;
 	}
 
@@ -382,28 +440,25 @@ namespace rsl {
 	RSL_UNUSED
 	StaticArray<T, CAPACITY>& StaticArray<T, CAPACITY>::operator=(StaticArray<T, CAPACITY_>&& other) noexcept {
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
-		static rsl::size_t otherLength = other.length();
-		static const T* otherContainer = other.getRowArray();
-		containerLength = otherLength;
-		RSL_RUNTIME_BOUND_CHECK_ARG(otherLength > CAPACITY, "Assignment failed! Capacity is too small.",
+		containerLength = other.length();
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength > CAPACITY, "Assignment failed! Capacity is too small.",
 		                            containerLength = CAPACITY;);
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
-			this->container[i] = otherContainer[i];
-		}
+		for (rsl::size_t index = 0; index < containerLength; ++index)
+			container[index] = std::move(other.get(index));
+		other.empty();
+		return *this;
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	bool StaticArray<T, CAPACITY>::operator==(const StaticArray<T, CAPACITY_>& other) const {
-		static const T* otherContainer = other.getRowArray();
+		const T* otherContainer = other.getRowArray();
 		if (containerLength != other.length())
 			return false;
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			if (this->container[i] != otherContainer[i])
 				return false;
 		}
@@ -452,16 +507,58 @@ namespace rsl {
 		++containerLength;
 	}
 
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::addFront(T&& element) {
+		emplace(0, std::move(element));
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::addBack(T&& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return;);
+		container[containerLength] = std::move(element);
+		++containerLength;
+	}
+
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticArray<T, CAPACITY>::add(rsl::size_t index, const T& element) {
-		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY || CAPACITY <= index, "Out of Capacity, addBack failed",
+		emplace(index, element);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::add(rsl::size_t index, T&& element) {
+		emplace(index, std::move(element));
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::emplaceFront(Args&& ... args) {
+		emplace(0, std::forward<Args>(args)...);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::emplaceBack(Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, emplaceBack failed", return;);
+		rsl::reconstruct(container[containerLength], std::forward<Args>(args)...);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::emplace(rsl::size_t index, Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY || index > containerLength, "Out of Capacity, emplace failed",
 		                            return;);
-		static rsl::size_t i;
-		for (i = containerLength; i > index; --i) {
-			container[i] = container[i - 1];
-		}
-		container[index] = element;
+		// built before shifting, args may refer to an element of the array
+		T element(std::forward<Args>(args)...);
+		rsl::moveRange(container + index + 1, container + index, containerLength - index);
+		container[index] = std::move(element);
 		++containerLength;
 	}
 
@@ -476,33 +573,53 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	void StaticArray<T, CAPACITY>::appendBack(const StaticArray<T, CAPACITY_>& array) {
-		static rsl::size_t arraySize = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + arraySize >= CAPACITY, "Out of Capacity, addBack failed",
+		rsl::size_t arraySize = array.length();
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + arraySize > CAPACITY, "Out of Capacity, addBack failed",
 		                            return;);
-		static rsl::size_t i;
-		for (i = 0; i < arraySize; ++i) {
-			container[containerLength + i] = arrayContainer[i];
-		}
+		// the source ends before the appended slots, so appending the array to itself is fine
+		rsl::copyRange(container + containerLength, array.getRowArray(), arraySize);
 		containerLength += arraySize;
 	}
 
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename U>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::appendBack(const Span<U>& span) {
+		rsl::size_t spanLength = span.length();
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + spanLength > CAPACITY, "Out of Capacity, addBack failed",
+		                            return;);
+		// the source ends before the appended slots, so a span of this array is fine
+		rsl::copyRange(container + containerLength, span.data(), spanLength);
+		containerLength += spanLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename U>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::appendBack(const RingSpan<U>& span) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + span.length() > CAPACITY, "Out of Capacity, addBack failed",
+		                            return;);
+		appendBack(span.firstSpan());
+		appendBack(span.secondSpan());
+	}
+
 	template<typename T, rsl::size_t CAPACITY>
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	void StaticArray<T, CAPACITY>::append(rsl::size_t index, const StaticArray<T, CAPACITY_>& array) {
-		static rsl::size_t arraySize = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + arraySize >= CAPACITY || CAPACITY <= index,
-		                            "Out of Capacity, addBack failed", return;);
-		static rsl::size_t i;
-		for (i = index; i < containerLength; ++i) {
-			container[i + containerLength - 1] = container[i];
-		} // move the elements
-		for (i = 0; i < arraySize; ++i) {
-			container[index + i] = arrayContainer[i];
-		} // add the elements
-		containerLength += arraySize;
+		insert(index, array.getRowArray(), array.getRowArray() + array.length());
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename ITERATOR>
+	RSL_UNUSED
+	void StaticArray<T, CAPACITY>::insert(rsl::size_t index, ITERATOR first, ITERATOR last) {
+		rsl::size_t count = rsl::distance(first, last);
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength + count > CAPACITY || index > containerLength,
+		                            "Out of Capacity, insert failed", return;);
+		rsl::moveRange(container + index + count, container + index, containerLength - index);
+		rsl::copyRange(container + index, first, count);
+		containerLength += count;
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -533,11 +650,8 @@ namespace rsl {
 	RSL_UNUSED
 	T StaticArray<T, CAPACITY>::remove(rsl::size_t index) {
 		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Out of Capacity, addBack failed", return defaultValue;);
-		static T temp = container[index];
-		static rsl::size_t i;
-		for (i = index; i < containerLength - 1; ++i) {
-			container[i] = container[i + 1];
-		}
+		T temp = std::move(container[index]);
+		rsl::moveRange(container + index, container + index + 1, containerLength - index - 1);
 		--containerLength;
 		return temp;
 	}
@@ -545,13 +659,10 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	bool StaticArray<T, CAPACITY>::searchRemove(const T& element) {
-		static rsl::signed_size_t index;
-		index = indexOf(element);
+		rsl::signed_size_t index = indexOf(element);
 		if (index == -1)
 			return false;
-		for (; index < containerLength - 1; ++index) {
-			container[index] = container[index + 1];
-		}
+		rsl::moveRange(container + index, container + index + 1, containerLength - index - 1);
 		--containerLength;
 		return true;
 	}
@@ -560,19 +671,18 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	bool StaticArray<T, CAPACITY>::removeAll(const StaticArray<T, CAPACITY_>& array) {
-		static bool flag = false;
-		static rsl::size_t arraySize = array.length();
-		static const T* arrayContainer = array.getRowArray();
-		static rsl::size_t i, k;
-		for (i = 0; i < arraySize; ++i) {
-			for (k = 0; k < containerLength; ++k) {
-				if (arrayContainer[i] == this->container[k]) {
-					this->remove(k);
-					flag = true;
-				}
-			}
+		// compact the kept elements in a single pass instead of shifting the tail once per removal
+		rsl::size_t kept = 0;
+		for (rsl::size_t index = 0; index < containerLength; ++index) {
+			if (array.contains(container[index]))
+				continue;
+			if (kept != index)
+				container[kept] = std::move(container[index]);
+			++kept;
 		}
-		return flag;
+		bool removed = (kept != containerLength);
+		containerLength = kept;
+		return removed;
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -580,10 +690,7 @@ namespace rsl {
 	void StaticArray<T, CAPACITY>::removeRange(rsl::size_t fromIndex, rsl::size_t toIndex) {
 		RSL_RUNTIME_BOUND_CHECK_ARG(fromIndex >= containerLength || toIndex >= containerLength || fromIndex > toIndex,
 		                            "Arguments out of bounds", return;);
-		static rsl::size_t i;
-		for (i = toIndex + 1; i < containerLength; ++i) {
-			container[fromIndex + i - toIndex - 1] = container[i];
-		}
+		rsl::moveRange(container + fromIndex, container + toIndex + 1, containerLength - toIndex - 1);
 		containerLength -= (toIndex - fromIndex + 1);
 	}
 
@@ -602,8 +709,7 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	bool StaticArray<T, CAPACITY>::contains(const T& element) const {
-		static rsl::size_t i;
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			if (container[i] == element)
 				return true;
 		}
@@ -639,10 +745,9 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	rsl::signed_size_t StaticArray<T, CAPACITY>::indexOf(const T& element) const {
-		static rsl::signed_size_t i;
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			if (container[i] == element)
-				return i;
+				return static_cast<rsl::signed_size_t>(i);
 		}
 		return -1;
 	}
@@ -650,8 +755,7 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	rsl::signed_size_t StaticArray<T, CAPACITY>::lastIndexOf(const T& element) const {
-		static rsl::signed_size_t i;
-		for (i = containerLength - 1; i >= 0; --i) {
+		for (rsl::signed_size_t i = containerLength - 1; i >= 0; --i) {
 			if (container[i] == element)
 				return i;
 		}
@@ -664,12 +768,23 @@ namespace rsl {
 		return container;
 	}
 
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	Span<T> StaticArray<T, CAPACITY>::span() {
+		return Span<T>(container, containerLength);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	Span<const T> StaticArray<T, CAPACITY>::span() const {
+		return Span<const T>(container, containerLength);
+	}
+
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticArray<T, CAPACITY>::print() const {
-		static rsl::size_t i;
 		RSL_PRINT("Array[");
-		for (i = 0; i < containerLength; ++i) {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
 			RSL_PRINT(container[i]);
 			if (i < containerLength - 1) {
 				RSL_PRINT(",");
@@ -687,7 +802,7 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	typename StaticArray<T, CAPACITY>::Iterator StaticArray<T, CAPACITY>::end() {
-		return Iterator{container};
+		return Iterator{container + containerLength};
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -0,0 +1,370 @@
+//
+// Created by robcholz on 11/16/23.
+//
+#pragma once
+
+#ifndef RSL_STATICHASHMAP_HPP
+#define RSL_STATICHASHMAP_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "HashMap.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage A stack-allocated, fixed-size hash map with O(1) put, find and remove that never allocates
+	 * @tparam K key type, compared with ==
+	 * @tparam V value type
+	 * @tparam DEFAULT_CAPACITY max number of elements, the slot table is a power of two at most 7/8 full
+	 * @tparam HASH hash function object
+	 */
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY = 10, typename HASH=Hash<K>>
+	class RSL_UNUSED StaticHashMap {
+	private:
+		using Table = RobinHoodTable<K, V, HASH>;
+		using Entry = HashMapEntry<K, V>;
+		static constexpr rsl::size_t STORAGE_CAPACITY = Table::storageFor(DEFAULT_CAPACITY);
+		static constexpr rsl::size_t MASK = STORAGE_CAPACITY - 1;
+
+	public:
+		using Iterator = HashMapIterator<K, V>;
+
+		/**
+		 * @usage construct an empty hash map
+		 */
+		StaticHashMap();
+
+		/**
+		 * @usage copy constructor
+		 * @param other another instance
+		 */
+		StaticHashMap(const StaticHashMap& other);
+
+		/**
+		 * @usage copy assignment
+		 * @param other another instance
+		 * @return this instance
+		 */
+		StaticHashMap& operator=(const StaticHashMap& other);
+
+		~StaticHashMap();
+
+		/**
+		 * @usage get the value of the key, a default constructed value is added if the key is missing
+		 * @param key
+		 * @return the reference of the value, default value if the key is missing and the map is full
+		 */
+		V& operator[](const K& key);
+
+		/**
+		 * @usage add the key or replace its value
+		 * @param key
+		 * @param value
+		 * @return false if the key is missing and the map is full
+		 */
+		RSL_UNUSED bool put(const K& key, const V& value);
+
+		RSL_UNUSED bool put(const K& key, V&& value);
+
+		/**
+		 * @usage build the value in place if the key is missing, an existing value is left untouched
+		 * @param key
+		 * @param args arguments forwarded to the constructor of V
+		 * @return false if the key is missing and the map is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED bool emplace(const K& key, Args&& ... args);
+
+		/**
+		 * @usage look the key up
+		 * @param key
+		 * @return pointer to the value, nullptr if the key is missing
+		 */
+		RSL_UNUSED V* find(const K& key);
+
+		RSL_UNUSED const V* find(const K& key) const;
+
+		/**
+		 * @usage get the value of the key
+		 * @param key
+		 * @return the reference of the value, default value if the key is missing
+		 */
+		RSL_UNUSED V& get(const K& key);
+
+		/**
+		 * @usage remove the key and its value
+		 * @param key
+		 * @return true if the key was found
+		 */
+		RSL_UNUSED bool remove(const K& key);
+
+		/**
+		 * @usage remove every element
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage check if the key is in the map
+		 * @param key
+		 * @return true if found
+		 */
+		RSL_UNUSED bool contains(const K& key) const;
+
+		/**
+		 * @usage check if the hash map is empty
+		 * @return true if empty
+		 */
+		RSL_NODISCARD bool isEmpty() const;
+
+		/**
+		 * @usage check if the hash map is full
+		 * @return true if full
+		 */
+		RSL_NODISCARD bool isFull() const;
+
+		/**
+		 * @return number of elements
+		 */
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @return max number of elements
+		 */
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+		/**
+		 * @usage print every key and value, in slot order
+		 */
+		RSL_UNUSED void print() const;
+
+		/**
+		 * @usage iterator func, visits the elements in slot order
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+
+	private:
+		alignas(Entry) unsigned char storage[sizeof(Entry) * STORAGE_CAPACITY];
+		unsigned char probes[STORAGE_CAPACITY]{};
+		rsl::size_t containerLength{0};
+		inline static V defaultValue{};
+
+		Entry* entries() const;
+
+		template<typename... Args>
+		V* findOrEmplace(const K& key, Args&& ... args);
+
+		// add a missing key at the slot locate returned, nullptr if the map is full
+		template<typename... Args>
+		V* emplaceAt(rsl::size_t slot, unsigned char probe, const K& key, Args&& ... args);
+	};
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::StaticHashMap() {
+		RSL_COMPILETIME_BOUND_CHECK(DEFAULT_CAPACITY > 0, "Capacity must be larger than 0.");
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::StaticHashMap(const StaticHashMap& other) {
+		// same table size and hash, so every entry goes to the same slot
+		for (rsl::size_t slot = 0; slot < STORAGE_CAPACITY; ++slot) {
+			if (other.probes[slot] != Table::EMPTY)
+				new(entries() + slot) Entry{other.entries()[slot]};
+			probes[slot] = other.probes[slot];
+		}
+		containerLength = other.containerLength;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>&
+	StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::operator=(const StaticHashMap& other) {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		empty();
+		for (rsl::size_t slot = 0; slot < STORAGE_CAPACITY; ++slot) {
+			if (other.probes[slot] != Table::EMPTY)
+				new(entries() + slot) Entry{other.entries()[slot]};
+			probes[slot] = other.probes[slot];
+		}
+		containerLength = other.containerLength;
+		return *this;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::~StaticHashMap() {
+		empty();
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	V& StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::operator[](const K& key) {
+		V* value = findOrEmplace(key);
+		RSL_RUNTIME_BOUND_CHECK_ARG(value == nullptr, "Out of Capacity, key is not added", return defaultValue;);
+		return *value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::put(const K& key, const V& value) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (Table::locate(entries(), probes, MASK, key, slot, probe)) {
+			entries()[slot].value = value;
+			return true;
+		}
+		return emplaceAt(slot, probe, key, value) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::put(const K& key, V&& value) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (Table::locate(entries(), probes, MASK, key, slot, probe)) {
+			entries()[slot].value = std::move(value);
+			return true;
+		}
+		return emplaceAt(slot, probe, key, std::move(value)) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	template<typename... Args>
+	RSL_UNUSED
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::emplace(const K& key, Args&& ... args) {
+		return findOrEmplace(key, std::forward<Args>(args)...) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	V* StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::find(const K& key) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (!Table::locate(entries(), probes, MASK, key, slot, probe))
+			return nullptr;
+		return &entries()[slot].value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	const V* StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::find(const K& key) const {
+		return const_cast<StaticHashMap*>(this)->find(key);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	V& StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::get(const K& key) {
+		V* value = find(key);
+		RSL_RUNTIME_BOUND_CHECK_ARG(value == nullptr, "Key not found", return defaultValue;);
+		return *value;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::remove(const K& key) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (!Table::locate(entries(), probes, MASK, key, slot, probe))
+			return false;
+		Table::erase(entries(), probes, MASK, slot);
+		--containerLength;
+		return true;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	void StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::empty() {
+		if (containerLength == 0)
+			return;
+		Table::clear(entries(), probes, STORAGE_CAPACITY);
+		containerLength = 0;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::contains(const K& key) const {
+		return find(key) != nullptr;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_NODISCARD
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::isEmpty() const {
+		return (containerLength == 0);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_NODISCARD
+	bool StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::isFull() const {
+		return (containerLength == DEFAULT_CAPACITY);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_NODISCARD
+	rsl::size_t StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::length() const {
+		return containerLength;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_NODISCARD
+	constexpr rsl::size_t StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::capacity() const {
+		return DEFAULT_CAPACITY;
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	RSL_UNUSED
+	void StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::print() const {
+		RSL_PRINT("{");
+		for (const Entry& entry: *this) {
+			RSL_PRINT(entry.key);
+			RSL_PRINT(": ");
+			RSL_PRINT(entry.value);
+			RSL_PRINT(", ");
+		}
+		RSL_PRINTF("}");
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	typename StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::Iterator StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::begin() const {
+		return Iterator(entries(), probes, 0, STORAGE_CAPACITY);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	typename StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::Iterator StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::end() const {
+		return Iterator(entries(), probes, STORAGE_CAPACITY, STORAGE_CAPACITY);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	typename StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::Entry* StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::entries() const {
+		return reinterpret_cast<Entry*>(const_cast<unsigned char*>(storage));
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	template<typename... Args>
+	V* StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::findOrEmplace(const K& key, Args&& ... args) {
+		rsl::size_t slot;
+		unsigned char probe;
+		if (Table::locate(entries(), probes, MASK, key, slot, probe))
+			return &entries()[slot].value;
+		return emplaceAt(slot, probe, key, std::forward<Args>(args)...);
+	}
+
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY, typename HASH>
+	template<typename... Args>
+	V* StaticHashMap<K, V, DEFAULT_CAPACITY, HASH>::emplaceAt(rsl::size_t slot, unsigned char probe, const K& key, Args&& ... args) {
+		if (containerLength >= DEFAULT_CAPACITY)
+			return nullptr;
+		// built before shifting, key and args may refer to an entry of the map
+		if (!Table::insert(entries(), probes, MASK, slot, probe, Entry{key, V(std::forward<Args>(args)...)}))
+			return nullptr;
+		++containerLength;
+		return &entries()[slot].value;
+	}
+}
+
+#endif //RSL_STATICHASHMAP_HPP
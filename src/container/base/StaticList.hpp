@@ -7,6 +7,7 @@
 #define RSL_STATICLIST_HPP
 
 #include <Internal.hpp>
+#include <utils/Utils.hpp>
 #include "List.hpp"
 
 
@@ -54,10 +55,10 @@ namespace rsl {
 		StaticList& operator=(const StaticList<T, CAPACITY_>& other);
 
 		/**
-		 * @usage move constructor
-		 * @param other instance
+		 * @usage move assignment, the elements are moved one by one since they live inside the list
+		 * @param other instance, left empty
 		 * @return new instance
-		 * @attention if the length of the copied list is larger than the capacity of the list copied to, the list will be filled
+		 * @attention if the length of the moved list is larger than the capacity of the list moved to, the list will be filled
 		 */
 		template<rsl::size_t CAPACITY_>
 		StaticList& operator=(StaticList<T, CAPACITY_>&& other) noexcept;
@@ -96,6 +97,8 @@ namespace rsl {
 
 		RSL_UNUSED void addFront(const T& element);
 
+		RSL_UNUSED void addFront(T&& element);
+
 		/**
 		 * @usage addBack an element to the end of the list
 		 * @param element
@@ -103,6 +106,24 @@ namespace rsl {
 		 */
 		RSL_UNUSED void addBack(const T& element);
 
+		RSL_UNUSED void addBack(T&& element);
+
+		/**
+		 * @usage construct an element in place at the front of the list
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if list is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the list
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if list is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
 		/**
 		 * @usage append another list to the end of the list
 		 * @param list
@@ -198,6 +219,10 @@ namespace rsl {
 
 		RSL_UNUSED rsl::size_t malloc();
 
+		rsl::size_t linkFront();
+
+		rsl::size_t linkBack();
+
 		/**
  		 * @usage remove the element at the given pointer
 		 * @param pointer
@@ -328,12 +353,13 @@ namespace rsl {
 	StaticList<T, CAPACITY>& StaticList<T, CAPACITY>::operator=(StaticList<T, CAPACITY_>&& other) noexcept {
 		RSL_RUNTIME_BOUND_CHECK_ARG((other.length() > CAPACITY), "Assignment incomplete! Capacity is too small.",);
 		// guard self assignment
-		if (this == &other)
+		if (reinterpret_cast<const void*>(this) == reinterpret_cast<const void*>(&other))
 			return *this;
 		init();
-		for (const auto& element: other) {
-			addBack(element);
+		for (auto& element: other) {
+			addBack(std::move(element));
 		}
+		other.empty();
 		return *this;
 	}
 
@@ -375,34 +401,51 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticList<T, CAPACITY>::addFront(const T& element) {
-		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return;);
-		static rsl::size_t node_new;
-		node_new = StaticList::malloc();
-		container[node_new].data = element;
-
-		container[node_new].next = container[head].next; // r next
-		container[container[head].next].prev = node_new; // r prev
+		rsl::size_t node = linkFront();
+		if (node != 0)
+			container[node].data = element;
+	}
 
-		container[head].next = node_new; // l next
-		container[node_new].prev = head; // l prev
-		++containerLength;
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticList<T, CAPACITY>::addFront(T&& element) {
+		rsl::size_t node = linkFront();
+		if (node != 0)
+			container[node].data = std::move(element);
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticList<T, CAPACITY>::addBack(const T& element) {
-		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return;);
-		static rsl::size_t node_new;
-		node_new = StaticList::malloc();
-		container[node_new].data = element;
+		rsl::size_t node = linkBack();
+		if (node != 0)
+			container[node].data = element;
+	}
 
-		container[container[tail].prev].next = node_new;
-		container[node_new].prev = container[tail].prev;
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticList<T, CAPACITY>::addBack(T&& element) {
+		rsl::size_t node = linkBack();
+		if (node != 0)
+			container[node].data = std::move(element);
+	}
 
-		container[tail].prev = node_new; // r
-		container[node_new].next = tail; // l
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticList<T, CAPACITY>::emplaceFront(Args&& ... args) {
+		rsl::size_t node = linkFront();
+		if (node != 0)
+			rsl::reconstruct(container[node].data, std::forward<Args>(args)...);
+	}
 
-		++containerLength;
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticList<T, CAPACITY>::emplaceBack(Args&& ... args) {
+		rsl::size_t node = linkBack();
+		if (node != 0)
+			rsl::reconstruct(container[node].data, std::forward<Args>(args)...);
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -429,13 +472,13 @@ namespace rsl {
 	RSL_UNUSED
 	T& StaticList<T, CAPACITY>::front() const {
 		RSL_RUNTIME_BOUND_CHECK_ARG(container[head].next == 0, "head->next is nullptr", return defaultValue);
-		return container[container[head].next].data;
+		return const_cast<T&>(container[container[head].next].data);
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	T& StaticList<T, CAPACITY>::back() const {
-		return container[container[tail].prev].data;
+		return const_cast<T&>(container[container[tail].prev].data);
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -453,14 +496,14 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	bool StaticList<T, CAPACITY>::searchRemove(const T& element) {
-		static rsl::size_t before;
-		before = container[head].next;
-		while (before != 0 && container[before].next != 0) {
-			if (container[container[before].next].data == element) {
-				StaticList::remove(before, container[container[before].next].next);
+		rsl::size_t before = head;
+		while (container[before].next != tail) {
+			rsl::size_t node = container[before].next;
+			if (container[node].data == element) {
+				StaticList::remove(before, container[node].next);
 				return true;
 			}
-			before = container[before].next;
+			before = node;
 		}
 		return false;
 	}
@@ -469,12 +512,12 @@ namespace rsl {
 	template<rsl::size_t CAPACITY_>
 	RSL_UNUSED
 	bool StaticList<T, CAPACITY>::removeAll(const StaticList<T, CAPACITY_>& list) {
-		static bool flag = false;
+		bool removed = false;
 		for (const auto& element: list) {
-			searchRemove(element);
-			flag = true;
+			while (searchRemove(element))
+				removed = true;
 		}
-		return flag;
+		return removed;
 	}
 
 	template<typename T, rsl::size_t CAPACITY>
@@ -520,8 +563,7 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticList<T, CAPACITY>::print() const {
-		static rsl::size_t i;
-		i = 0;
+		rsl::size_t i = 0;
 		RSL_PRINT("StaticList[");
 		for (const auto& element: *this) {
 			RSL_PRINT(element);
@@ -548,12 +590,11 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticList<T, CAPACITY>::createReservedList() {
-		static rsl::size_t i;
 		head = 0;
 		tail = 1;
 		reservedHead = 2;
 		container[reservedHead].next = 3;
-		for (i = 3; i < CAPACITY + 3; ++i) {
+		for (rsl::size_t i = 3; i < CAPACITY + 3; ++i) {
 			container[i].next = i + 1;
 		}
 		container[CAPACITY + 2].next = 0;
@@ -574,8 +615,7 @@ namespace rsl {
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	rsl::size_t StaticList<T, CAPACITY>::malloc() {
-		static rsl::size_t returned_node;
-		returned_node = container[reservedHead].next;
+		rsl::size_t returned_node = container[reservedHead].next;
 		if (returned_node == 0)
 			return 0;
 		container[reservedHead].next = container[returned_node].next;
@@ -584,11 +624,39 @@ namespace rsl {
 		return returned_node;
 	}
 
+	template<typename T, rsl::size_t CAPACITY>
+	rsl::size_t StaticList<T, CAPACITY>::linkFront() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addFront failed", return 0;);
+		rsl::size_t node_new = StaticList::malloc();
+
+		container[node_new].next = container[head].next; // r next
+		container[container[head].next].prev = node_new; // r prev
+
+		container[head].next = node_new; // l next
+		container[node_new].prev = head; // l prev
+		++containerLength;
+		return node_new;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	rsl::size_t StaticList<T, CAPACITY>::linkBack() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return 0;);
+		rsl::size_t node_new = StaticList::malloc();
+
+		container[container[tail].prev].next = node_new;
+		container[node_new].prev = container[tail].prev;
+
+		container[tail].prev = node_new; // r
+		container[node_new].next = tail; // l
+
+		++containerLength;
+		return node_new;
+	}
+
 	template<typename T, rsl::size_t CAPACITY>
 	RSL_UNUSED
 	void StaticList<T, CAPACITY>::remove(rsl::size_t before, rsl::size_t after) {
-		static rsl::size_t reservedNode;
-		reservedNode = container[before].next;
+		rsl::size_t reservedNode = container[before].next;
 
 		container[before].next = after;
 		container[after].prev = before;
@@ -0,0 +1,559 @@
+//
+// Created by robcholz on 11/4/23.
+//
+#pragma once
+
+#ifndef RSL_STATICRINGBUFFER_HPP
+#define RSL_STATICRINGBUFFER_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "Span.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage A stack-allocated, fixed-size ring buffer with O(1) add and pop at both ends
+	 * @tparam T element type
+	 * @tparam DEFAULT_CAPACITY ring buffer capacity, the storage is rounded up to a power of two so indexes can be masked
+	 */
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
+	class RSL_UNUSED StaticRingBuffer {
+	private:
+		static constexpr rsl::size_t STORAGE_CAPACITY = rsl::nextPowerOfTwo(DEFAULT_CAPACITY);
+		static constexpr rsl::size_t MASK = STORAGE_CAPACITY - 1;
+
+	public:
+		/**
+		 * @usage construct a static ring buffer object
+		 */
+		constexpr StaticRingBuffer();
+
+		/**
+		 * @usage construct with arguments
+		 * @tparam Args type that matches T
+		 * @param args parameter list
+		 * @attention the length of the args should not be larger than the capacity
+		 */
+		template<typename... Args>
+		explicit StaticRingBuffer(const Args& ... args);
+
+		/**
+		 * @usage copy constructor
+		 * @param other another instance
+		 */
+		StaticRingBuffer(const StaticRingBuffer& other) = default;
+
+		/**
+		 * @usage move constructor, the elements are moved one by one and other is left empty
+		 * @param other another instance
+		 */
+		StaticRingBuffer(StaticRingBuffer&& other) noexcept;
+
+		/**
+		 * @usage copy assignment
+		 * @param other instance
+		 * @return this instance
+		 */
+		StaticRingBuffer& operator=(const StaticRingBuffer& other) = default;
+
+		/**
+		 * @usage move assignment, the elements are moved one by one and other is left empty
+		 * @param other instance
+		 * @return this instance
+		 */
+		StaticRingBuffer& operator=(StaticRingBuffer&& other) noexcept;
+
+		/**
+		 * @usage get the reference of the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the reference of the element at the given index, default value if out of bound
+		 */
+		T& operator[](rsl::size_t index);
+
+		/**
+		 * @usage get the element at the given index, counted from the front. this is equivalent to get(size_t index)
+		 * @param index
+		 * @return the element at the given index, default value if out of bound
+		 */
+		const T& operator[](rsl::size_t index) const;
+
+		/**
+		 * @usage default destructor
+		 */
+		~StaticRingBuffer() = default;
+
+		/**
+		 * @usage add an element to the front of the ring buffer
+		 * @param element
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		RSL_UNUSED void addFront(const T& element);
+
+		RSL_UNUSED void addFront(T&& element);
+
+		/**
+		 * @usage add an element to the end of the ring buffer
+		 * @param element
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		RSL_UNUSED void addBack(const T& element);
+
+		RSL_UNUSED void addBack(T&& element);
+
+		/**
+		 * @usage construct an element in place at the front of the ring buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceFront(Args&& ... args);
+
+		/**
+		 * @usage construct an element in place at the end of the ring buffer
+		 * @param args arguments forwarded to the constructor of T
+		 * @attention operation will be ignored if ring buffer is full
+		 */
+		template<typename... Args>
+		RSL_UNUSED void emplaceBack(Args&& ... args);
+
+		RSL_UNUSED T& front() const;
+
+		RSL_UNUSED T& back() const;
+
+		RSL_UNUSED void popFront();
+
+		RSL_UNUSED void popBack();
+
+		/**
+		 * @usage empty the entire ring buffer
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage check if the ring buffer is empty
+		 * @return true if empty
+		 */
+		RSL_NODISCARD bool isEmpty() const;
+
+		/**
+		 * @usage check if the ring buffer is full
+		 * @return true if full
+		 */
+		RSL_NODISCARD bool isFull() const;
+
+		/**
+		 * @usage check if an element is contained in the ring buffer
+		 * @param element
+		 * @return true if the given element is contained
+		 */
+		RSL_UNUSED bool contains(const T& element) const;
+
+		/**
+		 * @usage get the length of the ring buffer
+		 * @return the length of the ring buffer
+		 */
+		RSL_NODISCARD rsl::size_t length() const;
+
+		/**
+		 * @usage get the capacity, max elements the ring buffer can hold
+		 * @return capacity
+		 */
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+		/**
+		 * @usage get the reference of the element at the given index, counted from the front. this is equivalent to operator[]
+		 * @param index
+		 * @return the reference of the element, the default value of T if index out of bound
+		 */
+		RSL_UNUSED T& get(rsl::size_t index);
+
+		/**
+		 * @usage get the element at the given index, counted from the front. this is equivalent to operator[]
+		 * @param index
+		 * @return the element, the default value of T if index out of bound
+		 */
+		RSL_UNUSED T get(rsl::size_t index) const;
+
+		/**
+		 * @usage get the first contiguous segment of the ring buffer, starting at the front
+		 * @param segmentLength receives the number of elements in the segment
+		 * @return the const pointer to the first element of the segment
+		 */
+		RSL_UNUSED const T* firstSegment(rsl::size_t& segmentLength) const;
+
+		/**
+		 * @usage get the second contiguous segment of the ring buffer, the part that wrapped around to the start of the storage
+		 * @param segmentLength receives the number of elements in the segment, 0 if the elements do not wrap
+		 * @return the const pointer to the first element of the segment
+		 */
+		RSL_UNUSED const T* secondSegment(rsl::size_t& segmentLength) const;
+
+		/**
+		 * @usage get a view of the elements as the two segments above, nothing is copied
+		 * @return the view, invalidated by anything that adds or removes elements
+		 */
+		RSL_NODISCARD RingSpan<T> span();
+
+		RSL_NODISCARD RingSpan<const T> span() const;
+
+		/**
+		 * @usage print the ring buffer
+		 */
+		RSL_UNUSED void print() const;
+
+	private:
+		T container[STORAGE_CAPACITY]{}; // row array
+		rsl::size_t head{}; // masked index of the front element
+		rsl::size_t containerLength{}; // the current length of the ring buffer
+		inline static T defaultValue{0};
+
+		template<typename Arg, typename... Args>
+		void addVariadic(const Arg& arg, const Args& ... args);
+
+		void addVariadic();
+
+	public:
+		class RSL_UNUSED Iterator {
+		private:
+			T* containerPtr;
+			rsl::size_t current; // unmasked index, masked on access
+
+		public:
+			using iterator_category RSL_UNUSED = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			RSL_UNUSED
+			Iterator(pointer ptr, rsl::size_t current) : containerPtr(ptr), current(current) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current && containerPtr == other.containerPtr;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(current == other.current && containerPtr == other.containerPtr);
+			}
+
+			reference operator*() const {
+				return containerPtr[current & MASK];
+			}
+
+			pointer operator->() const {
+				return &(containerPtr[current & MASK]);
+			}
+
+			reference operator[](difference_type offset) const {
+				return containerPtr[(current + offset) & MASK];
+			}
+
+			Iterator& operator++() {
+				++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			Iterator& operator--() {
+				--current;
+				return *this;
+			}
+
+			Iterator operator--(int) {
+				Iterator temp = *this;
+				--(*this);
+				return temp;
+			}
+
+			Iterator& operator+=(difference_type offset) {
+				current += offset;
+				return *this;
+			}
+
+			Iterator& operator-=(difference_type offset) {
+				current -= offset;
+				return *this;
+			}
+
+			Iterator operator+(difference_type offset) const {
+				return Iterator(containerPtr, current + offset);
+			}
+
+			Iterator operator-(difference_type offset) const {
+				return Iterator(containerPtr, current - offset);
+			}
+
+			difference_type operator-(const Iterator& other) const {
+				return static_cast<difference_type>(current - other.current);
+			}
+		};
+
+		/**
+		 * @usage iterator func
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		/**
+		 * @usage iterator func
+		 * @return end
+		 */
+		Iterator end() const;
+	};
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	constexpr StaticRingBuffer<T, CAPACITY>::StaticRingBuffer() : head(0), containerLength(0) {
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	StaticRingBuffer<T, CAPACITY>::StaticRingBuffer(const Args& ... args) : head(0), containerLength(0) {
+		RSL_COMPILETIME_BOUND_CHECK(sizeof...(args) <= CAPACITY, "Too many arguments to addBack into the ring buffer.");
+		(addVariadic((args)...));
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	StaticRingBuffer<T, CAPACITY>::StaticRingBuffer(StaticRingBuffer&& other) noexcept : head(0), containerLength(0) {
+		for (T& element: other)
+			addBack(std::move(element));
+		other.empty();
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	StaticRingBuffer<T, CAPACITY>& StaticRingBuffer<T, CAPACITY>::operator=(StaticRingBuffer&& other) noexcept {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		empty();
+		for (T& element: other)
+			addBack(std::move(element));
+		other.empty();
+		return *this;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	T& StaticRingBuffer<T, CAPACITY>::operator[](rsl::size_t index) {
+		return get(index);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	const T& StaticRingBuffer<T, CAPACITY>::operator[](rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & MASK];
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::addFront(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addFront failed", return;);
+		head = (head - 1) & MASK;
+		container[head] = element;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::addFront(T&& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addFront failed", return;);
+		head = (head - 1) & MASK;
+		container[head] = std::move(element);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::addBack(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return;);
+		container[(head + containerLength) & MASK] = element;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::addBack(T&& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, addBack failed", return;);
+		container[(head + containerLength) & MASK] = std::move(element);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::emplaceFront(Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, emplaceFront failed", return;);
+		// the slot is outside the ring buffer, args can not refer to it
+		rsl::reconstruct(container[(head - 1) & MASK], std::forward<Args>(args)...);
+		head = (head - 1) & MASK;
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename... Args>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::emplaceBack(Args&& ... args) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength >= CAPACITY, "Out of Capacity, emplaceBack failed", return;);
+		rsl::reconstruct(container[(head + containerLength) & MASK], std::forward<Args>(args)...);
+		++containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	T& StaticRingBuffer<T, CAPACITY>::front() const {
+		return const_cast<T&>(container[head]);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	T& StaticRingBuffer<T, CAPACITY>::back() const {
+		return const_cast<T&>(container[(head + containerLength - 1) & MASK]);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::popFront() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength == 0, "Ring buffer is empty, popFront failed", return;);
+		head = (head + 1) & MASK;
+		--containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::popBack() {
+		RSL_RUNTIME_BOUND_CHECK_ARG(containerLength == 0, "Ring buffer is empty, popBack failed", return;);
+		--containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::empty() {
+		head = 0;
+		containerLength = 0;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	bool StaticRingBuffer<T, CAPACITY>::isEmpty() const {
+		return (containerLength == 0);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	bool StaticRingBuffer<T, CAPACITY>::isFull() const {
+		return (containerLength == CAPACITY);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	bool StaticRingBuffer<T, CAPACITY>::contains(const T& element) const {
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
+			if (container[(head + i) & MASK] == element)
+				return true;
+		}
+		return false;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	rsl::size_t StaticRingBuffer<T, CAPACITY>::length() const {
+		return containerLength;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	constexpr rsl::size_t StaticRingBuffer<T, CAPACITY>::capacity() const {
+		return CAPACITY;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	T& StaticRingBuffer<T, CAPACITY>::get(rsl::size_t index) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & MASK];
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	T StaticRingBuffer<T, CAPACITY>::get(rsl::size_t index) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(index >= containerLength, "Index out of bound", return defaultValue;);
+		return container[(head + index) & MASK];
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	const T* StaticRingBuffer<T, CAPACITY>::firstSegment(rsl::size_t& segmentLength) const {
+		segmentLength = rsl::min(containerLength, STORAGE_CAPACITY - head);
+		return container + head;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	const T* StaticRingBuffer<T, CAPACITY>::secondSegment(rsl::size_t& segmentLength) const {
+		segmentLength = containerLength - rsl::min(containerLength, STORAGE_CAPACITY - head);
+		return container;
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	RingSpan<T> StaticRingBuffer<T, CAPACITY>::span() {
+		rsl::size_t firstLength = rsl::min(containerLength, STORAGE_CAPACITY - head);
+		return RingSpan<T>(Span<T>(container + head, firstLength), Span<T>(container, containerLength - firstLength));
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_NODISCARD
+	RingSpan<const T> StaticRingBuffer<T, CAPACITY>::span() const {
+		rsl::size_t firstLength = rsl::min(containerLength, STORAGE_CAPACITY - head);
+		return RingSpan<const T>(Span<const T>(container + head, firstLength),
+		                         Span<const T>(container, containerLength - firstLength));
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	void StaticRingBuffer<T, CAPACITY>::print() const {
+		RSL_PRINT("RingBuffer[");
+		for (rsl::size_t i = 0; i < containerLength; ++i) {
+			RSL_PRINT(container[(head + i) & MASK]);
+			if (i < containerLength - 1) {
+				RSL_PRINT(",");
+			}
+		}
+		RSL_PRINT("]");
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	typename StaticRingBuffer<T, CAPACITY>::Iterator StaticRingBuffer<T, CAPACITY>::begin() const {
+		return Iterator((T*) container, head);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	RSL_UNUSED
+	typename StaticRingBuffer<T, CAPACITY>::Iterator StaticRingBuffer<T, CAPACITY>::end() const {
+		return Iterator((T*) container, head + containerLength);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	template<typename Arg, typename... Args>
+	void StaticRingBuffer<T, CAPACITY>::addVariadic(const Arg& arg, const Args& ... args) {
+		addBack(arg);
+		addVariadic(args...);
+	}
+
+	template<typename T, rsl::size_t CAPACITY>
+	void StaticRingBuffer<T, CAPACITY>::addVariadic() {}
+}
+
+
+#endif //RSL_STATICRINGBUFFER_HPP
@@ -3,50 +3,164 @@
 //
 #pragma once
 
-#ifndef RSL_ALLOCATOR_HPP
-#define RSL_ALLOCATOR_HPP
+#ifndef RSL_BYTEALLOCATOR_HPP
+#define RSL_BYTEALLOCATOR_HPP
 
 #include <Internal.hpp>
+#include "SystemHeap.hpp"
 
 
 namespace rsl {
-	template<typename T, rsl::signed_size_t MAX_BYTES = -1>
+	/**
+	 * @usage Allocates blocks of bytes from BACKEND
+	 * @tparam T element type of the returned pointer
+	 * @tparam MAX_BYTES max number of bytes allocated at the same time, -1 for no limit
+	 * @tparam BACKEND SystemHeap for plain RSL_mm_ALLOC, or ThreadCache to cache small blocks per thread
+	 * @attention malloc returns raw memory, objects have to be constructed and destroyed by the caller.
+	 * the byte count is atomic, so one allocator can be shared between threads
+	 */
+	template<typename T, rsl::signed_size_t MAX_BYTES = -1, typename BACKEND = SystemHeap>
 	class RSL_UNUSED ByteAllocator {
 	public:
+		ByteAllocator() = default;
+
+		/**
+		 * @usage a copy starts with no bytes allocated, blocks are never shared between allocators
+		 */
+		ByteAllocator(const ByteAllocator&);
+
+		ByteAllocator& operator=(const ByteAllocator&);
+
+		/**
+		 * @usage a moved to allocator takes over the byte count, the blocks move along with the container owning them
+		 */
+		ByteAllocator(ByteAllocator&& other) noexcept;
+
+		ByteAllocator& operator=(ByteAllocator&& other) noexcept;
+
 		RSL_UNUSED T* malloc(rsl::size_t size);
 
 		RSL_UNUSED void free(rsl::ptr_t ptr);
 
+		/**
+		 * @usage resize a block returned by malloc without moving it
+		 * @param ptr
+		 * @param size new size in bytes
+		 * @return false if the block cannot be resized in place or the limit would be exceeded, always false over
+		 * SystemHeap
+		 */
+		RSL_UNUSED bool tryExpand(rsl::ptr_t ptr, rsl::size_t size);
+
+		/**
+		 * @return bytes allocated, not counted by an unlimited allocator over SystemHeap, which keeps no block sizes
+		 */
 		RSL_NODISCARD rsl::size_t size() const;
 
 		RSL_NODISCARD rsl::signed_size_t maxBytes() const;
 
 	private:
-		rsl::size_t allocatedBytes = 0;
+		// size of a block handed out over a backend that does not record it, only kept when there is a limit to enforce
+		struct alignas(alignof(std::max_align_t)) Prefix {
+			rsl::size_t bytes;
+		};
+
+		static constexpr bool COUNTED = BACKEND::RECORDS_SIZE || MAX_BYTES != -1;
+		static constexpr rsl::size_t PREFIX_BYTES = BACKEND::RECORDS_SIZE || MAX_BYTES == -1 ? 0 : sizeof(Prefix);
+
+		std::atomic<rsl::size_t> allocatedBytes{0};
+
+		static rsl::size_t requestedBytes(rsl::ptr_t ptr);
 	};
 
-	template<typename T, rsl::signed_size_t MAX_BYTES>
-	T* ByteAllocator<T, MAX_BYTES>::malloc(rsl::size_t size) {
-		RSL_RUNTIME_BOUND_CHECK_ARG(MAX_BYTES != -1 && allocatedBytes >= MAX_BYTES, "Allocated objects reached limit", return nullptr;);
-		allocatedBytes += size;
-		return (T*) (::malloc(size));
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	ByteAllocator<T, MAX_BYTES, BACKEND>::ByteAllocator(const ByteAllocator&) {}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	ByteAllocator<T, MAX_BYTES, BACKEND>& ByteAllocator<T, MAX_BYTES, BACKEND>::operator=(const ByteAllocator&) {
+		return *this;
 	}
 
-	template<typename T, rsl::signed_size_t MAX_BYTES>
-	void ByteAllocator<T, MAX_BYTES>::free(rsl::ptr_t ptr) {
-		--allocatedBytes;
-		::free(ptr);
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	ByteAllocator<T, MAX_BYTES, BACKEND>::ByteAllocator(ByteAllocator&& other) noexcept
+			: allocatedBytes(other.allocatedBytes.exchange(0, std::memory_order_relaxed)) {}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	ByteAllocator<T, MAX_BYTES, BACKEND>& ByteAllocator<T, MAX_BYTES, BACKEND>::operator=(ByteAllocator&& other) noexcept {
+		if (this != &other)
+			allocatedBytes.fetch_add(other.allocatedBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	T* ByteAllocator<T, MAX_BYTES, BACKEND>::malloc(rsl::size_t size) {
+		if constexpr (!COUNTED)
+			return static_cast<T*>(BACKEND::allocate(size));
+		rsl::size_t previous = allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		if (MAX_BYTES != -1 && previous + size > static_cast<rsl::size_t>(MAX_BYTES)) {
+			allocatedBytes.fetch_sub(size, std::memory_order_relaxed);
+			RSL_LOG_ERROR("Allocated bytes reached limit");
+			return nullptr;
+		}
+		auto* block = static_cast<unsigned char*>(BACKEND::allocate(PREFIX_BYTES + size));
+		if (block == nullptr) {
+			allocatedBytes.fetch_sub(size, std::memory_order_relaxed);
+			return nullptr;
+		}
+		if constexpr (PREFIX_BYTES > 0)
+			reinterpret_cast<Prefix*>(block)->bytes = size;
+		return reinterpret_cast<T*>(block + PREFIX_BYTES);
+	}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	void ByteAllocator<T, MAX_BYTES, BACKEND>::free(rsl::ptr_t ptr) {
+		if (ptr == nullptr)
+			return;
+		if constexpr (COUNTED)
+			allocatedBytes.fetch_sub(requestedBytes(ptr), std::memory_order_relaxed);
+		BACKEND::deallocate(static_cast<unsigned char*>(ptr) - PREFIX_BYTES);
 	}
 
-	template<typename T, rsl::signed_size_t MAX_BYTES>
-	rsl::size_t ByteAllocator<T, MAX_BYTES>::size() const {
-		return allocatedBytes;
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	bool ByteAllocator<T, MAX_BYTES, BACKEND>::tryExpand(RSL_UNUSED rsl::ptr_t ptr, RSL_UNUSED rsl::size_t size) {
+		if constexpr (!BACKEND::RECORDS_SIZE) {
+			return false;
+		} else {
+			if (ptr == nullptr)
+				return false;
+			rsl::size_t previousSize = BACKEND::requestedBytes(ptr);
+			if (size > previousSize) {
+				rsl::size_t previous = allocatedBytes.fetch_add(size - previousSize, std::memory_order_relaxed);
+				if ((MAX_BYTES != -1 && previous + size - previousSize > static_cast<rsl::size_t>(MAX_BYTES)) ||
+				    !BACKEND::tryExpand(ptr, size)) {
+					allocatedBytes.fetch_sub(size - previousSize, std::memory_order_relaxed);
+					return false;
+				}
+				return true;
+			}
+			if (!BACKEND::tryExpand(ptr, size))
+				return false;
+			allocatedBytes.fetch_sub(previousSize - size, std::memory_order_relaxed);
+			return true;
+		}
 	}
 
-	template<typename T, rsl::signed_size_t MAX_BYTES>
-	rsl::signed_size_t ByteAllocator<T, MAX_BYTES>::maxBytes() const {
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	rsl::size_t ByteAllocator<T, MAX_BYTES, BACKEND>::size() const {
+		return allocatedBytes.load(std::memory_order_relaxed);
+	}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	rsl::signed_size_t ByteAllocator<T, MAX_BYTES, BACKEND>::maxBytes() const {
 		return MAX_BYTES;
 	}
+
+	template<typename T, rsl::signed_size_t MAX_BYTES, typename BACKEND>
+	rsl::size_t ByteAllocator<T, MAX_BYTES, BACKEND>::requestedBytes(rsl::ptr_t ptr) {
+		if constexpr (BACKEND::RECORDS_SIZE)
+			return BACKEND::requestedBytes(ptr);
+		else
+			return reinterpret_cast<Prefix*>(static_cast<unsigned char*>(ptr) - PREFIX_BYTES)->bytes;
+	}
 }
 
-#endif //RSL_ALLOCATOR_HPP
+#endif //RSL_BYTEALLOCATOR_HPP
@@ -7,16 +7,31 @@
 #define RSL_HEAPALLOCATOR_HPP
 
 #include <Internal.hpp>
-#include "container/base/List.hpp"
 
 
 namespace rsl {
+	/**
+	 * @usage Fixed size object pool over an inline arena of MAX_OBJECTS slots, free slots are kept in an
+	 * intrusive free list so malloc and free are O(1). see SlabAllocator for a pool that grows by chunks
+	 * @tparam T object type
+	 * @tparam MAX_OBJECTS number of slots
+	 * @attention like ObjectAllocator, malloc returns raw memory, objects have to be constructed and destroyed by the caller
+	 */
 	template<typename T, rsl::signed_size_t MAX_OBJECTS>
 	class RSL_UNUSED HeapAllocator {
 	public:
 		RSL_UNUSED HeapAllocator();
 
-		RSL_UNUSED T* malloc(rsl::size_t size = -1);
+		HeapAllocator(const HeapAllocator&) = delete;
+
+		HeapAllocator& operator=(const HeapAllocator&) = delete;
+
+		/**
+		 * @usage take a slot for one object
+		 * @param size bytes needed, a slot always holds one T
+		 * @return the slot, nullptr if all slots are in use or size is larger than a T
+		 */
+		RSL_UNUSED T* malloc(rsl::size_t size = sizeof(T));
 
 		RSL_UNUSED void free(rsl::ptr_t ptr);
 
@@ -28,41 +43,65 @@ namespace rsl {
 
 		RSL_NODISCARD constexpr rsl::signed_size_t maxBytes() const;
 
+		RSL_NODISCARD constexpr rsl::signed_size_t maxObjects() const;
+
+		/**
+		 * @return most objects ever allocated at the same time
+		 */
+		RSL_NODISCARD rsl::size_t highWaterMark() const;
+
+		/**
+		 * @return number of malloc calls that returned nullptr
+		 */
+		RSL_NODISCARD rsl::size_t failures() const;
+
 	private:
-		ListNode<T> container[MAX_OBJECTS + 1]; // one extra object for reservedHead
-		const ListNode<T>* reservedHead;
+		union Slot {
+			Slot* next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		Slot container[MAX_OBJECTS];
+		Slot* freeList;
 		rsl::size_t allocNum;
+		rsl::size_t peakNum;
+		rsl::size_t failedNum;
 	};
 
 	template<typename T, rsl::signed_size_t MAX_OBJECTS>
-	HeapAllocator<T, MAX_OBJECTS>::HeapAllocator(): reservedHead(nullptr), allocNum(0) {
-		RSL_COMPILETIME_BOUND_CHECK(MAX_OBJECTS >= 0, "");
-		static ListNode<T>* node;
-		static rsl::size_t index;
-		reservedHead = &container[0];
-		node = reservedHead;
-		for (index = 1; index < allocNum; ++index) {
-			node->next = &container[index];
-			container[index].next = nullptr;
-			node = node->next;
+	HeapAllocator<T, MAX_OBJECTS>::HeapAllocator(): freeList(nullptr), allocNum(0), peakNum(0), failedNum(0) {
+		RSL_COMPILETIME_BOUND_CHECK(MAX_OBJECTS > 0, "Pool must hold at least one object.");
+		for (rsl::signed_size_t index = MAX_OBJECTS; index > 0; --index) {
+			container[index - 1].next = freeList;
+			freeList = &container[index - 1];
 		}
 	}
 
 	template<typename T, rsl::signed_size_t MAX_OBJECTS>
 	T* HeapAllocator<T, MAX_OBJECTS>::malloc(rsl::size_t size) {
-		RSL_RUNTIME_BOUND_CHECK_ARG(allocNum >= MAX_OBJECTS, "Allocated objects reached limit", return nullptr;);
-		static ListNode<T>* node;
-		node = reservedHead->next;
-		reservedHead->next = node->next;
-		++allocNum;
-		return node;
+		if (size > sizeof(T)) {
+			++failedNum;
+			RSL_LOG_ERROR("Requested size is larger than a slot");
+			return nullptr;
+		}
+		if (freeList == nullptr) {
+			++failedNum;
+			RSL_LOG_ERROR("Allocated objects reached limit");
+			return nullptr;
+		}
+		Slot* slot = freeList;
+		freeList = slot->next;
+		if (++allocNum > peakNum)
+			peakNum = allocNum;
+		return reinterpret_cast<T*>(slot->storage);
 	}
 
 	template<typename T, rsl::signed_size_t MAX_OBJECTS>
 	void HeapAllocator<T, MAX_OBJECTS>::free(rsl::ptr_t ptr) {
-		RSL_RUNTIME_BOUND_CHECK_ARG((ptr >= container[0] && ptr <= container[MAX_OBJECTS - 1]), "", return;);
-		((ListNode<T>*) ptr)->next = reservedHead->next;
-		reservedHead->next = ptr;
+		auto* slot = reinterpret_cast<Slot*>(ptr);
+		RSL_RUNTIME_BOUND_CHECK_ARG(slot < &container[0] || slot > &container[MAX_OBJECTS - 1], "Pointer is not from this allocator", return;);
+		slot->next = freeList;
+		freeList = slot;
 		--allocNum;
 	}
 
@@ -85,6 +124,21 @@ namespace rsl {
 	constexpr rsl::signed_size_t HeapAllocator<T, MAX_OBJECTS>::maxBytes() const {
 		return MAX_OBJECTS * sizeof(T);
 	}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS>
+	constexpr rsl::signed_size_t HeapAllocator<T, MAX_OBJECTS>::maxObjects() const {
+		return MAX_OBJECTS;
+	}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS>
+	rsl::size_t HeapAllocator<T, MAX_OBJECTS>::highWaterMark() const {
+		return peakNum;
+	}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS>
+	rsl::size_t HeapAllocator<T, MAX_OBJECTS>::failures() const {
+		return failedNum;
+	}
 }
 
 #endif //RSL_HEAPALLOCATOR_HPP
@@ -0,0 +1,129 @@
+//
+// Created by robcholz on 11/20/23.
+//
+#pragma once
+
+#ifndef RSL_INLINEALLOCATOR_HPP
+#define RSL_INLINEALLOCATOR_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+#include "ByteAllocator.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage Byte allocator with room for INLINE_CAPACITY objects inside itself. a request that fits is served from
+	 * that buffer, anything larger or a second block goes to ALLOCATOR. a DynamicArray using it keeps its first
+	 * INLINE_CAPACITY elements in the array object and only touches the heap once it grows past them
+	 * @tparam T element type of the returned pointer
+	 * @tparam INLINE_CAPACITY number of objects the inline buffer holds
+	 * @tparam ALLOCATOR byte allocator for the blocks that do not fit
+	 * @attention blocks may live inside the allocator, so it cannot be moved. a copy starts with an unused buffer
+	 */
+	template<typename T, rsl::size_t INLINE_CAPACITY = 8, typename ALLOCATOR = ByteAllocator<T>>
+	class RSL_UNUSED InlineAllocator {
+	public:
+		InlineAllocator() = default;
+
+		/**
+		 * @usage a copy starts with an unused buffer and a copy of the fallback allocator
+		 */
+		InlineAllocator(const InlineAllocator& other);
+
+		InlineAllocator& operator=(const InlineAllocator& other);
+
+		InlineAllocator(InlineAllocator&& other) = delete;
+
+		InlineAllocator& operator=(InlineAllocator&& other) = delete;
+
+		RSL_UNUSED T* malloc(rsl::size_t size);
+
+		RSL_UNUSED void free(rsl::ptr_t ptr);
+
+		/**
+		 * @usage resize a block returned by malloc without moving it
+		 * @param ptr
+		 * @param size new size in bytes
+		 * @return true if the block is the inline buffer and size fits it, otherwise what the fallback allocator
+		 * returns, false if it cannot resize blocks
+		 */
+		RSL_UNUSED bool tryExpand(rsl::ptr_t ptr, rsl::size_t size);
+
+		/**
+		 * @usage check if a block is the inline buffer
+		 * @param ptr
+		 * @return true if ptr points to the inline buffer
+		 */
+		RSL_NODISCARD bool isInline(rsl::ptr_t ptr) const;
+
+		/**
+		 * @return bytes taken from the fallback allocator
+		 */
+		RSL_NODISCARD rsl::size_t size() const;
+
+		RSL_NODISCARD constexpr rsl::size_t inlineCapacity() const;
+
+	private:
+		static constexpr rsl::size_t INLINE_BYTES = sizeof(T) * INLINE_CAPACITY;
+
+		alignas(T) unsigned char buffer[INLINE_BYTES];
+		bool bufferUsed{false};
+		ALLOCATOR allocator;
+
+		RSL_COMPILETIME_BOUND_CHECK(INLINE_CAPACITY > 0, "Inline capacity must be larger than 0.");
+	};
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::InlineAllocator(const InlineAllocator& other) : allocator(other.allocator) {}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>& InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::operator=(const InlineAllocator&) {
+		// the own blocks stay where they are
+		return *this;
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	T* InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::malloc(rsl::size_t size) {
+		if (!bufferUsed && size <= INLINE_BYTES) {
+			bufferUsed = true;
+			return reinterpret_cast<T*>(buffer);
+		}
+		return allocator.malloc(size);
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	void InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::free(rsl::ptr_t ptr) {
+		if (isInline(ptr)) {
+			bufferUsed = false;
+			return;
+		}
+		allocator.free(ptr);
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	bool InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::tryExpand(rsl::ptr_t ptr, rsl::size_t size) {
+		if (isInline(ptr))
+			return size <= INLINE_BYTES;
+		if constexpr (rsl::hasTryExpand<ALLOCATOR>::value)
+			return allocator.tryExpand(ptr, size);
+		return false;
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	bool InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::isInline(rsl::ptr_t ptr) const {
+		return ptr == static_cast<const void*>(buffer);
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	rsl::size_t InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::size() const {
+		return allocator.size();
+	}
+
+	template<typename T, rsl::size_t INLINE_CAPACITY, typename ALLOCATOR>
+	constexpr rsl::size_t InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>::inlineCapacity() const {
+		return INLINE_CAPACITY;
+	}
+}
+
+#endif //RSL_INLINEALLOCATOR_HPP
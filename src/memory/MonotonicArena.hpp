@@ -0,0 +1,396 @@
+//
+// Created by robcholz on 11/14/23.
+//
+#pragma once
+
+#ifndef RSL_MONOTONICARENA_HPP
+#define RSL_MONOTONICARENA_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Monotonic (bump) arena. allocations are carved out of an optional caller provided buffer first
+	 * and then out of heap blocks chained behind it, each one costs a pointer bump. nothing is given back on
+	 * its own, rewind and reset release everything allocated after a marker in one go
+	 * @attention objects living in the arena are not destroyed by reset, destroy them first
+	 */
+	class RSL_UNUSED MonotonicArena {
+	public:
+		static constexpr rsl::size_t DEFAULT_BLOCK_BYTES = 4096;
+		static constexpr rsl::size_t MAX_BLOCK_BYTES = 1 << 20;
+
+		/**
+		 * @usage position of the arena returned by mark, allocations made after it are released by rewind
+		 */
+		struct Marker {
+			rsl::ptr_t block;
+			rsl::size_t offset;
+			rsl::size_t used;
+		};
+
+		/**
+		 * @param blockBytes size of the first heap block, later blocks double up to MAX_BLOCK_BYTES
+		 */
+		RSL_UNUSED explicit MonotonicArena(rsl::size_t blockBytes = DEFAULT_BLOCK_BYTES);
+
+		/**
+		 * @param buffer used before any heap block is taken, has to outlive the arena
+		 * @param bufferBytes
+		 * @param blockBytes size of the first heap block, later blocks double up to MAX_BLOCK_BYTES
+		 */
+		RSL_UNUSED MonotonicArena(rsl::ptr_t buffer, rsl::size_t bufferBytes, rsl::size_t blockBytes = DEFAULT_BLOCK_BYTES);
+
+		MonotonicArena(const MonotonicArena&) = delete;
+
+		MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+		~MonotonicArena();
+
+		/**
+		 * @usage take bytes from the arena
+		 * @param bytes
+		 * @param alignment power of two
+		 * @return the memory, nullptr if the system is out of memory
+		 */
+		RSL_UNUSED rsl::ptr_t allocate(rsl::size_t bytes, rsl::size_t alignment = alignof(std::max_align_t));
+
+		/**
+		 * @usage resize the latest allocation in place, it simply moves the bump pointer
+		 * @param ptr
+		 * @param bytes new size
+		 * @return false if ptr is not the latest allocation or the region has no room left
+		 */
+		RSL_UNUSED bool tryExpand(rsl::ptr_t ptr, rsl::size_t bytes);
+
+		/**
+		 * @return current position of the arena
+		 */
+		RSL_NODISCARD Marker mark() const;
+
+		/**
+		 * @usage release everything allocated after marker, heap blocks taken since then go back to the system
+		 * @param marker returned by mark of this arena
+		 */
+		RSL_UNUSED void rewind(const Marker& marker);
+
+		/**
+		 * @usage release everything, only the caller provided buffer is kept
+		 */
+		RSL_UNUSED void reset();
+
+		/**
+		 * @return bytes handed out since the last reset, alignment padding included
+		 */
+		RSL_NODISCARD rsl::size_t size() const;
+
+		/**
+		 * @return number of heap blocks currently chained
+		 */
+		RSL_NODISCARD rsl::size_t blocks() const;
+
+		/**
+		 * @return arena of the innermost ArenaScope of the calling thread, nullptr if there is none
+		 */
+		RSL_NODISCARD static MonotonicArena* current();
+
+	private:
+		friend class ArenaScope;
+
+		struct alignas(alignof(std::max_align_t)) Block {
+			Block* previous;
+			rsl::size_t bytes; // usable bytes behind the header
+		};
+
+		unsigned char* buffer;
+		rsl::size_t bufferBytes;
+		Block* head{nullptr}; // newest block, nullptr while allocating from the buffer
+		rsl::size_t offset{0}; // used bytes of the newest block or the buffer
+		unsigned char* lastAllocation{nullptr};
+		rsl::size_t nextBlockBytes;
+		rsl::size_t blockCount{0};
+		rsl::size_t usedBytes{0};
+
+		inline static thread_local MonotonicArena* currentArena{nullptr};
+
+		unsigned char* region() const;
+
+		rsl::size_t regionBytes() const;
+
+		rsl::size_t paddingOf(rsl::size_t position, rsl::size_t alignment) const;
+
+		bool grow(rsl::size_t bytes, rsl::size_t alignment);
+	};
+
+	/**
+	 * @usage Monotonic arena with an inline buffer of INLINE_BYTES, small scratch workloads never touch the heap
+	 * @tparam INLINE_BYTES
+	 */
+	template<rsl::size_t INLINE_BYTES = 1024>
+	class RSL_UNUSED StaticMonotonicArena : public MonotonicArena {
+	public:
+		RSL_UNUSED explicit StaticMonotonicArena(rsl::size_t blockBytes = DEFAULT_BLOCK_BYTES);
+
+	private:
+		alignas(alignof(std::max_align_t)) unsigned char inlineBuffer[INLINE_BYTES];
+	};
+
+	/**
+	 * @usage makes arena the current arena of the calling thread, containers using ArenaAllocator created inside
+	 * the scope allocate from it. when the scope ends the arena is rewound to where it was when the scope began
+	 * @attention containers created inside the scope have to be destroyed before it ends
+	 */
+	class RSL_UNUSED ArenaScope {
+	public:
+		RSL_UNUSED explicit ArenaScope(MonotonicArena& arena);
+
+		ArenaScope(const ArenaScope&) = delete;
+
+		ArenaScope& operator=(const ArenaScope&) = delete;
+
+		~ArenaScope();
+
+	private:
+		MonotonicArena& arena;
+		MonotonicArena* previousArena;
+		MonotonicArena::Marker marker;
+	};
+
+	/**
+	 * @usage Allocator over a MonotonicArena, fits the ALLOCATOR parameter of both byte based containers
+	 * (DynamicArray, DynamicRingBuffer) and node based ones (DynamicList). free does nothing, the memory
+	 * is released when the arena is reset or the enclosing ArenaScope ends
+	 * @tparam T object type
+	 * @attention a default constructed allocator binds to the current arena of the constructing thread
+	 */
+	template<typename T>
+	class RSL_UNUSED ArenaAllocator {
+	public:
+		RSL_UNUSED ArenaAllocator();
+
+		RSL_UNUSED explicit ArenaAllocator(MonotonicArena& arena);
+
+		RSL_UNUSED ArenaAllocator(const ArenaAllocator& allocator);
+
+		ArenaAllocator& operator=(const ArenaAllocator& allocator);
+
+		/**
+		 * @param size bytes, one T if omitted
+		 * @return the memory, nullptr if there is no arena or the system is out of memory
+		 */
+		RSL_UNUSED T* malloc(rsl::size_t size = sizeof(T));
+
+		/**
+		 * @usage does nothing, kept for the allocator interface
+		 */
+		RSL_UNUSED void free(rsl::ptr_t ptr);
+
+		/**
+		 * @usage resize the latest allocation of the arena in place
+		 * @param ptr
+		 * @param size new size in bytes
+		 * @return false if ptr is not the latest allocation of the arena or there is no room left
+		 */
+		RSL_UNUSED bool tryExpand(rsl::ptr_t ptr, rsl::size_t size);
+
+		/**
+		 * @return bytes taken from the arena by this allocator
+		 */
+		RSL_NODISCARD rsl::size_t size() const;
+
+		RSL_NODISCARD constexpr rsl::signed_size_t maxBytes() const;
+
+		RSL_NODISCARD constexpr rsl::signed_size_t maxObjects() const;
+
+		/**
+		 * @return the arena this allocator takes from, nullptr if it is not bound
+		 */
+		RSL_NODISCARD MonotonicArena* arena() const;
+
+	private:
+		MonotonicArena* boundArena;
+		rsl::size_t allocatedBytes{0};
+	};
+
+	inline MonotonicArena::MonotonicArena(rsl::size_t blockBytes)
+			: buffer(nullptr), bufferBytes(0), nextBlockBytes(blockBytes) {}
+
+	inline MonotonicArena::MonotonicArena(rsl::ptr_t buffer, rsl::size_t bufferBytes, rsl::size_t blockBytes)
+			: buffer(static_cast<unsigned char*>(buffer)), bufferBytes(bufferBytes), nextBlockBytes(blockBytes) {}
+
+	inline MonotonicArena::~MonotonicArena() {
+		reset();
+	}
+
+	inline rsl::ptr_t MonotonicArena::allocate(rsl::size_t bytes, rsl::size_t alignment) {
+		rsl::size_t padding = paddingOf(offset, alignment);
+		if (region() == nullptr || offset + padding + bytes > regionBytes()) {
+			if (!grow(bytes, alignment))
+				return nullptr;
+			padding = paddingOf(offset, alignment);
+		}
+		unsigned char* memory = region() + offset + padding;
+		offset += padding + bytes;
+		usedBytes += padding + bytes;
+		lastAllocation = memory;
+		return memory;
+	}
+
+	inline bool MonotonicArena::tryExpand(rsl::ptr_t ptr, rsl::size_t bytes) {
+		if (ptr == nullptr || ptr != lastAllocation)
+			return false;
+		rsl::size_t start = lastAllocation - region();
+		if (start + bytes > regionBytes())
+			return false;
+		usedBytes = usedBytes - offset + start + bytes;
+		offset = start + bytes;
+		return true;
+	}
+
+	inline MonotonicArena::Marker MonotonicArena::mark() const {
+		return {head, offset, usedBytes};
+	}
+
+	inline void MonotonicArena::rewind(const Marker& marker) {
+		while (head != marker.block && head != nullptr) {
+			Block* previous = head->previous;
+			RSL_mm_FREE(head);
+			head = previous;
+			--blockCount;
+		}
+		offset = marker.offset;
+		usedBytes = marker.used;
+		lastAllocation = nullptr;
+	}
+
+	inline void MonotonicArena::reset() {
+		rewind({nullptr, 0, 0});
+	}
+
+	inline rsl::size_t MonotonicArena::size() const {
+		return usedBytes;
+	}
+
+	inline rsl::size_t MonotonicArena::blocks() const {
+		return blockCount;
+	}
+
+	inline MonotonicArena* MonotonicArena::current() {
+		return currentArena;
+	}
+
+	inline unsigned char* MonotonicArena::region() const {
+		return head == nullptr ? buffer : reinterpret_cast<unsigned char*>(head + 1);
+	}
+
+	inline rsl::size_t MonotonicArena::regionBytes() const {
+		return head == nullptr ? bufferBytes : head->bytes;
+	}
+
+	inline rsl::size_t MonotonicArena::paddingOf(rsl::size_t position, rsl::size_t alignment) const {
+		auto address = reinterpret_cast<rsl::size_t>(region()) + position;
+		return (alignment - (address & (alignment - 1))) & (alignment - 1);
+	}
+
+	inline bool MonotonicArena::grow(rsl::size_t bytes, rsl::size_t alignment) {
+		// block data is max_align_t aligned, only stricter alignments need extra room
+		rsl::size_t needed = bytes + (alignment > alignof(std::max_align_t) ? alignment : 0);
+		rsl::size_t blockBytes = rsl::max(nextBlockBytes, needed);
+		auto* block = static_cast<Block*>(RSL_mm_ALLOC(sizeof(Block) + blockBytes));
+		if (block == nullptr) {
+			RSL_LOG_ERROR("Arena is out of memory");
+			return false;
+		}
+		// the rest of the region being left stays unused until the arena is rewound past this block
+		block->previous = head;
+		block->bytes = blockBytes;
+		head = block;
+		offset = 0;
+		++blockCount;
+		nextBlockBytes = rsl::min<rsl::size_t>(nextBlockBytes * 2, MAX_BLOCK_BYTES);
+		return true;
+	}
+
+	template<rsl::size_t INLINE_BYTES>
+	StaticMonotonicArena<INLINE_BYTES>::StaticMonotonicArena(rsl::size_t blockBytes)
+			: MonotonicArena(inlineBuffer, INLINE_BYTES, blockBytes) {}
+
+	inline ArenaScope::ArenaScope(MonotonicArena& arena)
+			: arena(arena), previousArena(MonotonicArena::currentArena), marker(arena.mark()) {
+		MonotonicArena::currentArena = &arena;
+	}
+
+	inline ArenaScope::~ArenaScope() {
+		arena.rewind(marker);
+		MonotonicArena::currentArena = previousArena;
+	}
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(): boundArena(MonotonicArena::current()) {}
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(MonotonicArena& arena): boundArena(&arena) {}
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator& allocator): boundArena(allocator.boundArena) {}
+
+	template<typename T>
+	ArenaAllocator<T>& ArenaAllocator<T>::operator=(const ArenaAllocator&) {
+		// the memory of a container stays in the arena it came from, so the binding is kept
+		return *this;
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	T* ArenaAllocator<T>::malloc(rsl::size_t size) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(boundArena == nullptr, "Allocator is not bound to an arena", return nullptr;);
+		auto* memory = static_cast<T*>(boundArena->allocate(size, alignof(T)));
+		if (memory != nullptr)
+			allocatedBytes += size;
+		return memory;
+	}
+
+	template<typename T>
+	RSL_UNUSED
+	void ArenaAllocator<T>::free(rsl::ptr_t) {}
+
+	template<typename T>
+	RSL_UNUSED
+	bool ArenaAllocator<T>::tryExpand(rsl::ptr_t ptr, rsl::size_t size) {
+		if (boundArena == nullptr)
+			return false;
+		rsl::size_t previousSize = boundArena->size();
+		if (!boundArena->tryExpand(ptr, size))
+			return false;
+		allocatedBytes = allocatedBytes + boundArena->size() - previousSize;
+		return true;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	rsl::size_t ArenaAllocator<T>::size() const {
+		return allocatedBytes;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	constexpr rsl::signed_size_t ArenaAllocator<T>::maxBytes() const {
+		return -1;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	constexpr rsl::signed_size_t ArenaAllocator<T>::maxObjects() const {
+		return -1;
+	}
+
+	template<typename T>
+	RSL_NODISCARD
+	MonotonicArena* ArenaAllocator<T>::arena() const {
+		return boundArena;
+	}
+}
+
+#endif //RSL_MONOTONICARENA_HPP
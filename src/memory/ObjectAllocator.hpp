@@ -3,16 +3,41 @@
 //
 #pragma once
 
-#ifndef RSL_ALLOCATOR_HPP
-#define RSL_ALLOCATOR_HPP
+#ifndef RSL_OBJECTALLOCATOR_HPP
+#define RSL_OBJECTALLOCATOR_HPP
 
 #include <Internal.hpp>
+#include "SystemHeap.hpp"
 
 
 namespace rsl {
-	template<typename T, rsl::signed_size_t MAX_OBJECTS = -1>
+	/**
+	 * @usage Allocates one object at a time from BACKEND
+	 * @tparam T object type
+	 * @tparam MAX_OBJECTS max number of objects allocated at the same time, -1 for no limit
+	 * @tparam BACKEND SystemHeap for plain RSL_mm_ALLOC, or ThreadCache to cache small blocks per thread
+	 * @attention malloc returns raw memory, objects have to be constructed and destroyed by the caller.
+	 * the object count is atomic, so one allocator can be shared between threads
+	 */
+	template<typename T, rsl::signed_size_t MAX_OBJECTS = -1, typename BACKEND = SystemHeap>
 	class RSL_UNUSED ObjectAllocator {
 	public:
+		ObjectAllocator() = default;
+
+		/**
+		 * @usage a copy starts with no objects, blocks are never shared between allocators
+		 */
+		ObjectAllocator(const ObjectAllocator&);
+
+		ObjectAllocator& operator=(const ObjectAllocator&);
+
+		/**
+		 * @usage a moved to allocator takes over the object count, the objects move along with the container owning them
+		 */
+		ObjectAllocator(ObjectAllocator&& other) noexcept;
+
+		ObjectAllocator& operator=(ObjectAllocator&& other) noexcept;
+
 		RSL_UNUSED T* malloc();
 
 		RSL_UNUSED void free(rsl::ptr_t ptr);
@@ -22,31 +47,59 @@ namespace rsl {
 		RSL_NODISCARD rsl::signed_size_t maxObjects() const;
 
 	private:
-		rsl::size_t allocatedObjects = 0;
+		std::atomic<rsl::size_t> allocatedObjects{0};
 	};
 
-	template<typename T, rsl::signed_size_t MAX_OBJECTS>
-	T* ObjectAllocator<T, MAX_OBJECTS>::malloc() {
-		RSL_RUNTIME_BOUND_CHECK_ARG(MAX_OBJECTS != -1 && allocatedObjects >= MAX_OBJECTS, "Allocated objects reached limit", return nullptr);
-		++allocatedObjects;
-		return (T*) (RSL_mm_ALLOC(sizeof(T)));
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	ObjectAllocator<T, MAX_OBJECTS, BACKEND>::ObjectAllocator(const ObjectAllocator&) {}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	ObjectAllocator<T, MAX_OBJECTS, BACKEND>& ObjectAllocator<T, MAX_OBJECTS, BACKEND>::operator=(const ObjectAllocator&) {
+		return *this;
+	}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	ObjectAllocator<T, MAX_OBJECTS, BACKEND>::ObjectAllocator(ObjectAllocator&& other) noexcept
+			: allocatedObjects(other.allocatedObjects.exchange(0, std::memory_order_relaxed)) {}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	ObjectAllocator<T, MAX_OBJECTS, BACKEND>& ObjectAllocator<T, MAX_OBJECTS, BACKEND>::operator=(ObjectAllocator&& other) noexcept {
+		if (this != &other)
+			allocatedObjects.fetch_add(other.allocatedObjects.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
+
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	T* ObjectAllocator<T, MAX_OBJECTS, BACKEND>::malloc() {
+		rsl::size_t previous = allocatedObjects.fetch_add(1, std::memory_order_relaxed);
+		if (MAX_OBJECTS != -1 && previous >= static_cast<rsl::size_t>(MAX_OBJECTS)) {
+			allocatedObjects.fetch_sub(1, std::memory_order_relaxed);
+			RSL_LOG_ERROR("Allocated objects reached limit");
+			return nullptr;
+		}
+		auto* object = static_cast<T*>(BACKEND::allocate(sizeof(T)));
+		if (object == nullptr)
+			allocatedObjects.fetch_sub(1, std::memory_order_relaxed);
+		return object;
 	}
 
-	template<typename T, rsl::signed_size_t MAX_OBJECTS>
-	void ObjectAllocator<T, MAX_OBJECTS>::free(rsl::ptr_t ptr) {
-		--allocatedObjects;
-		RSL_mm_FREE(ptr);
+	template<typename T, rsl::signed_size_t MAX_OBJECTS, typename BACKEND>
+	void ObjectAllocator<T, MAX_OBJECTS, BACKEND>::free(rsl::ptr_t ptr) {
+		if (ptr == nullptr)
+			return;
+		allocatedObjects.fetch_sub(1, std::memory_order_relaxed);
+		BACKEND::deallocate(ptr);
 	}
 
-	template<typename T, rsl::signed_size_t MAX_OBJECT>
-	rsl::size_t ObjectAllocator<T, MAX_OBJECT>::size() const {
-		return allocatedObjects;
+	template<typename T, rsl::signed_size_t MAX_OBJECT, typename BACKEND>
+	rsl::size_t ObjectAllocator<T, MAX_OBJECT, BACKEND>::size() const {
+		return allocatedObjects.load(std::memory_order_relaxed);
 	}
 
-	template<typename T, rsl::signed_size_t MAX_OBJECT>
-	rsl::signed_size_t ObjectAllocator<T, MAX_OBJECT>::maxObjects() const {
+	template<typename T, rsl::signed_size_t MAX_OBJECT, typename BACKEND>
+	rsl::signed_size_t ObjectAllocator<T, MAX_OBJECT, BACKEND>::maxObjects() const {
 		return MAX_OBJECT;
 	}
 }
 
-#endif //RSL_ALLOCATOR_HPP
+#endif //RSL_OBJECTALLOCATOR_HPP
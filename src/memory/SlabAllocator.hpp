@@ -0,0 +1,236 @@
+//
+// Created by robcholz on 11/12/23.
+//
+#pragma once
+
+#ifndef RSL_SLABALLOCATOR_HPP
+#define RSL_SLABALLOCATOR_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Fixed size object pool. memory is taken from the heap in chunks of CHUNK_OBJECTS slots and freed
+	 * slots are kept in an intrusive free list, so malloc and free are O(1) and never go back to the heap
+	 * until the allocator is destroyed
+	 * @tparam T object type
+	 * @tparam CHUNK_OBJECTS number of objects per chunk
+	 * @tparam MAX_CHUNKS max number of chunks, -1 for no limit
+	 * @attention like ObjectAllocator, malloc returns raw memory, objects have to be constructed and destroyed by the caller
+	 */
+	template<typename T, rsl::size_t CHUNK_OBJECTS = 32, rsl::signed_size_t MAX_CHUNKS = -1>
+	class RSL_UNUSED SlabAllocator {
+	public:
+		SlabAllocator() = default;
+
+		SlabAllocator(const SlabAllocator&) = delete;
+
+		SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+		/**
+		 * @usage take over the chunks of other, other is left empty
+		 */
+		SlabAllocator(SlabAllocator&& other) noexcept;
+
+		/**
+		 * @usage give back the own chunks and take over the chunks of other
+		 * @attention objects still allocated from this allocator are released with its chunks
+		 */
+		SlabAllocator& operator=(SlabAllocator&& other) noexcept;
+
+		~SlabAllocator();
+
+		/**
+		 * @usage take a slot for one object
+		 * @return the slot, nullptr if all chunks are in use and no chunk can be added
+		 */
+		RSL_UNUSED T* malloc();
+
+		/**
+		 * @usage give a slot back
+		 * @param ptr slot returned by malloc of this allocator
+		 */
+		RSL_UNUSED void free(rsl::ptr_t ptr);
+
+		/**
+		 * @usage allocate the chunks needed for objects slots up front
+		 * @param objects
+		 */
+		RSL_UNUSED void reserve(rsl::size_t objects);
+
+		/**
+		 * @return number of objects currently allocated
+		 */
+		RSL_NODISCARD rsl::size_t size() const;
+
+		/**
+		 * @return max number of objects, -1 for no limit
+		 */
+		RSL_NODISCARD constexpr rsl::signed_size_t maxObjects() const;
+
+		/**
+		 * @return most objects ever allocated at the same time
+		 */
+		RSL_NODISCARD rsl::size_t highWaterMark() const;
+
+		/**
+		 * @return number of malloc calls that returned nullptr
+		 */
+		RSL_NODISCARD rsl::size_t failures() const;
+
+		/**
+		 * @return number of chunks taken from the heap
+		 */
+		RSL_NODISCARD rsl::size_t chunks() const;
+
+	private:
+		union Slot {
+			Slot* next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		struct Chunk {
+			Chunk* next;
+			Slot slots[CHUNK_OBJECTS];
+		};
+
+		Chunk* chunkList{nullptr};
+		Slot* freeList{nullptr};
+		rsl::size_t allocatedObjects{0};
+		rsl::size_t peakObjects{0};
+		rsl::size_t failedAllocations{0};
+		rsl::size_t chunkCount{0};
+
+		bool grow();
+
+		void release();
+	};
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::SlabAllocator(SlabAllocator&& other) noexcept
+			: chunkList(other.chunkList), freeList(other.freeList), allocatedObjects(other.allocatedObjects),
+			  peakObjects(other.peakObjects), failedAllocations(other.failedAllocations), chunkCount(other.chunkCount) {
+		other.chunkList = nullptr;
+		other.freeList = nullptr;
+		other.allocatedObjects = other.peakObjects = other.failedAllocations = other.chunkCount = 0;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>&
+	SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::operator=(SlabAllocator&& other) noexcept {
+		if (this == &other)
+			return *this;
+		release();
+		chunkList = other.chunkList;
+		freeList = other.freeList;
+		allocatedObjects = other.allocatedObjects;
+		peakObjects = other.peakObjects;
+		failedAllocations = other.failedAllocations;
+		chunkCount = other.chunkCount;
+		other.chunkList = nullptr;
+		other.freeList = nullptr;
+		other.allocatedObjects = other.peakObjects = other.failedAllocations = other.chunkCount = 0;
+		return *this;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::~SlabAllocator() {
+		release();
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_UNUSED
+	T* SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::malloc() {
+		if (freeList == nullptr && !grow()) {
+			++failedAllocations;
+			RSL_LOG_ERROR("Allocated objects reached limit");
+			return nullptr;
+		}
+		Slot* slot = freeList;
+		freeList = slot->next;
+		if (++allocatedObjects > peakObjects)
+			peakObjects = allocatedObjects;
+		return reinterpret_cast<T*>(slot->storage);
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_UNUSED
+	void SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::free(rsl::ptr_t ptr) {
+		if (ptr == nullptr)
+			return;
+		auto* slot = reinterpret_cast<Slot*>(ptr);
+		slot->next = freeList;
+		freeList = slot;
+		--allocatedObjects;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_UNUSED
+	void SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::reserve(rsl::size_t objects) {
+		while (chunkCount * CHUNK_OBJECTS < objects && grow()) {}
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_NODISCARD
+	rsl::size_t SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::size() const {
+		return allocatedObjects;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_NODISCARD
+	constexpr rsl::signed_size_t SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::maxObjects() const {
+		return MAX_CHUNKS == -1 ? -1 : MAX_CHUNKS * static_cast<rsl::signed_size_t>(CHUNK_OBJECTS);
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_NODISCARD
+	rsl::size_t SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::highWaterMark() const {
+		return peakObjects;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_NODISCARD
+	rsl::size_t SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::failures() const {
+		return failedAllocations;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	RSL_NODISCARD
+	rsl::size_t SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::chunks() const {
+		return chunkCount;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	bool SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::grow() {
+		RSL_COMPILETIME_BOUND_CHECK(CHUNK_OBJECTS > 0, "Chunks must hold at least one object.");
+		if (MAX_CHUNKS != -1 && chunkCount >= static_cast<rsl::size_t>(MAX_CHUNKS))
+			return false;
+		auto* chunk = static_cast<Chunk*>(RSL_mm_ALLOC(sizeof(Chunk)));
+		if (chunk == nullptr)
+			return false;
+		chunk->next = chunkList;
+		chunkList = chunk;
+		++chunkCount;
+		// thread the new slots in address order so consecutive mallocs are adjacent
+		for (rsl::size_t index = CHUNK_OBJECTS; index > 0; --index) {
+			chunk->slots[index - 1].next = freeList;
+			freeList = &chunk->slots[index - 1];
+		}
+		return true;
+	}
+
+	template<typename T, rsl::size_t CHUNK_OBJECTS, rsl::signed_size_t MAX_CHUNKS>
+	void SlabAllocator<T, CHUNK_OBJECTS, MAX_CHUNKS>::release() {
+		while (chunkList != nullptr) {
+			Chunk* next = chunkList->next;
+			RSL_mm_FREE(chunkList);
+			chunkList = next;
+		}
+		freeList = nullptr;
+		allocatedObjects = 0;
+		chunkCount = 0;
+	}
+}
+
+#endif //RSL_SLABALLOCATOR_HPP
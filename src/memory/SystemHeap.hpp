@@ -0,0 +1,44 @@
+//
+// Created by robcholz on 11/26/23.
+//
+#pragma once
+
+#ifndef RSL_SYSTEMHEAP_HPP
+#define RSL_SYSTEMHEAP_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Default backend of ObjectAllocator and ByteAllocator, every block is one RSL_mm_ALLOC call with nothing
+	 * stored in front of it. pass ThreadCache as the backend to cache small blocks per thread instead
+	 * @attention the sizes of the blocks are not kept, so blocks cannot be resized in place
+	 */
+	struct RSL_UNUSED SystemHeap {
+		// whether the backend can tell the requested size of a block
+		static constexpr bool RECORDS_SIZE = false;
+
+		/**
+		 * @usage allocate a block
+		 * @param bytes
+		 * @return the block, nullptr if the system is out of memory
+		 */
+		RSL_UNUSED static rsl::ptr_t allocate(rsl::size_t bytes);
+
+		/**
+		 * @param ptr block returned by allocate, nullptr is ignored
+		 */
+		RSL_UNUSED static void deallocate(rsl::ptr_t ptr);
+	};
+
+	inline rsl::ptr_t SystemHeap::allocate(rsl::size_t bytes) {
+		return RSL_mm_ALLOC(bytes);
+	}
+
+	inline void SystemHeap::deallocate(rsl::ptr_t ptr) {
+		RSL_mm_FREE(ptr);
+	}
+}
+
+#endif //RSL_SYSTEMHEAP_HPP
@@ -0,0 +1,293 @@
+//
+// Created by robcholz on 11/13/23.
+//
+#pragma once
+
+#ifndef RSL_THREADCACHE_HPP
+#define RSL_THREADCACHE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+#ifndef ARDUINO
+
+namespace rsl {
+	/**
+	 * @usage Thread local caching backend, opted into with ObjectAllocator<T, MAX, ThreadCache> or
+	 * ByteAllocator<T, MAX, ThreadCache>. small blocks are rounded up to power of two size classes, every thread keeps
+	 * a free list per class and trades whole batches with a shared depot, so the depot lock is taken once per batch
+	 * instead of once per block and the heap lock almost never
+	 * @attention memory of cached blocks is kept for reuse and not given back to the system, and every block carries
+	 * a header of alignof(std::max_align_t) bytes. blocks larger than MAX_BLOCK go straight to RSL_mm_ALLOC, so do
+	 * blocks a thread asks for after its cache is destroyed at exit. needs thread_local and std::mutex, so it is not
+	 * available on ARDUINO
+	 */
+	class RSL_UNUSED ThreadCache {
+	public:
+		static constexpr rsl::size_t SIZE_CLASSES = 9;
+		static constexpr rsl::size_t MIN_BLOCK = 16;
+		static constexpr rsl::size_t MAX_BLOCK = MIN_BLOCK << (SIZE_CLASSES - 1);
+		// whether the backend can tell the requested size of a block
+		static constexpr bool RECORDS_SIZE = true;
+
+		ThreadCache(const ThreadCache&) = delete;
+
+		ThreadCache& operator=(const ThreadCache&) = delete;
+
+		/**
+		 * @usage allocate a block
+		 * @param bytes
+		 * @return the block, nullptr if the system is out of memory
+		 */
+		RSL_UNUSED static rsl::ptr_t allocate(rsl::size_t bytes);
+
+		/**
+		 * @usage give a block back to the cache of the calling thread, any thread may free any block
+		 * @param ptr block returned by allocate, nullptr is ignored
+		 */
+		RSL_UNUSED static void deallocate(rsl::ptr_t ptr);
+
+		/**
+		 * @param ptr block returned by allocate
+		 * @return the number of bytes asked for when the block was allocated
+		 */
+		RSL_NODISCARD static rsl::size_t requestedBytes(rsl::ptr_t ptr);
+
+		/**
+		 * @usage resize a block without moving it, works while bytes stays in the size class of the block
+		 * @param ptr block returned by allocate
+		 * @param bytes
+		 * @return false if the block has to be moved, it is left untouched then
+		 */
+		RSL_UNUSED static bool tryExpand(rsl::ptr_t ptr, rsl::size_t bytes);
+
+		/**
+		 * @usage give all blocks cached by the calling thread to the depot, done automatically when a thread exits
+		 */
+		RSL_UNUSED static void flush();
+
+		/**
+		 * @return number of free blocks cached by the calling thread
+		 */
+		RSL_NODISCARD static rsl::size_t cachedBlocks();
+
+	private:
+		struct alignas(alignof(std::max_align_t)) Header {
+			rsl::size_t bytes; // requested bytes, batch length while the block heads a batch in the depot
+			rsl::size_t sizeClass;
+		};
+
+		// overlays the user part of a free block
+		struct Block {
+			Block* next;
+			Block* nextBatch;
+		};
+
+		struct Depot {
+			std::mutex mutex;
+			Block* batches{nullptr};
+		};
+
+		struct FreeList {
+			Block* head{nullptr};
+			rsl::size_t count{0};
+		};
+
+		FreeList freeLists[SIZE_CLASSES];
+		static Depot depots[SIZE_CLASSES];
+		// trivially destructible, so it can still be read by static and thread_local destructors running after the cache
+		static thread_local bool destroyed;
+
+		ThreadCache() = default;
+
+		~ThreadCache();
+
+		/**
+		 * @return the cache of the calling thread, nullptr once it is destroyed
+		 */
+		static ThreadCache* local();
+
+		static Header* headerOf(rsl::ptr_t ptr);
+
+		static constexpr rsl::size_t blockSize(rsl::size_t sizeClass);
+
+		static constexpr rsl::size_t batchSize(rsl::size_t sizeClass);
+
+		static rsl::size_t sizeClassOf(rsl::size_t bytes);
+
+		bool refill(rsl::size_t sizeClass);
+
+		void release(rsl::size_t sizeClass, rsl::size_t count);
+	};
+
+	inline ThreadCache::Depot ThreadCache::depots[ThreadCache::SIZE_CLASSES];
+	inline thread_local bool ThreadCache::destroyed = false;
+
+	inline rsl::ptr_t ThreadCache::allocate(rsl::size_t bytes) {
+		ThreadCache* cache = bytes > MAX_BLOCK ? nullptr : local();
+		if (cache == nullptr) {
+			auto* header = static_cast<Header*>(RSL_mm_ALLOC(sizeof(Header) + bytes));
+			if (header == nullptr)
+				return nullptr;
+			header->bytes = bytes;
+			header->sizeClass = SIZE_CLASSES;
+			return header + 1;
+		}
+		rsl::size_t sizeClass = sizeClassOf(bytes);
+		FreeList& freeList = cache->freeLists[sizeClass];
+		if (freeList.head == nullptr && !cache->refill(sizeClass))
+			return nullptr;
+		Block* block = freeList.head;
+		freeList.head = block->next;
+		--freeList.count;
+		headerOf(block)->bytes = bytes;
+		return block;
+	}
+
+	inline void ThreadCache::deallocate(rsl::ptr_t ptr) {
+		if (ptr == nullptr)
+			return;
+		Header* header = headerOf(ptr);
+		if (header->sizeClass == SIZE_CLASSES) {
+			RSL_mm_FREE(header);
+			return;
+		}
+		rsl::size_t sizeClass = header->sizeClass;
+		auto* block = static_cast<Block*>(ptr);
+		ThreadCache* cache = local();
+		if (cache == nullptr) {
+			// freed by a destructor running after the cache of this thread, hand it to the depot as a batch of one
+			block->next = nullptr;
+			header->bytes = 1;
+			Depot& depot = depots[sizeClass];
+			std::lock_guard<std::mutex> lock(depot.mutex);
+			block->nextBatch = depot.batches;
+			depot.batches = block;
+			return;
+		}
+		FreeList& freeList = cache->freeLists[sizeClass];
+		block->next = freeList.head;
+		freeList.head = block;
+		// keep up to two batches, so a thread going back and forth around a batch boundary stays local
+		if (++freeList.count >= batchSize(sizeClass) * 2)
+			cache->release(sizeClass, batchSize(sizeClass));
+	}
+
+	inline rsl::size_t ThreadCache::requestedBytes(rsl::ptr_t ptr) {
+		return headerOf(ptr)->bytes;
+	}
+
+	inline bool ThreadCache::tryExpand(rsl::ptr_t ptr, rsl::size_t bytes) {
+		Header* header = headerOf(ptr);
+		// a smaller class would give memory back, so shrinking moves the block as well
+		if (header->sizeClass == SIZE_CLASSES || bytes > MAX_BLOCK || sizeClassOf(bytes) != header->sizeClass)
+			return false;
+		header->bytes = bytes;
+		return true;
+	}
+
+	inline void ThreadCache::flush() {
+		ThreadCache* cache = local();
+		if (cache == nullptr)
+			return;
+		for (rsl::size_t sizeClass = 0; sizeClass < SIZE_CLASSES; ++sizeClass) {
+			if (cache->freeLists[sizeClass].count > 0)
+				cache->release(sizeClass, cache->freeLists[sizeClass].count);
+		}
+	}
+
+	inline rsl::size_t ThreadCache::cachedBlocks() {
+		ThreadCache* cache = local();
+		if (cache == nullptr)
+			return 0;
+		rsl::size_t count = 0;
+		for (const FreeList& freeList: cache->freeLists)
+			count += freeList.count;
+		return count;
+	}
+
+	inline ThreadCache::~ThreadCache() {
+		destroyed = true;
+		for (rsl::size_t sizeClass = 0; sizeClass < SIZE_CLASSES; ++sizeClass) {
+			if (freeLists[sizeClass].count > 0)
+				release(sizeClass, freeLists[sizeClass].count);
+		}
+	}
+
+	inline ThreadCache* ThreadCache::local() {
+		if (destroyed)
+			return nullptr;
+		thread_local ThreadCache cache;
+		return &cache;
+	}
+
+	inline ThreadCache::Header* ThreadCache::headerOf(rsl::ptr_t ptr) {
+		return static_cast<Header*>(ptr) - 1;
+	}
+
+	inline constexpr rsl::size_t ThreadCache::blockSize(rsl::size_t sizeClass) {
+		return MIN_BLOCK << sizeClass;
+	}
+
+	inline constexpr rsl::size_t ThreadCache::batchSize(rsl::size_t sizeClass) {
+		// about 16KB per batch, at least 8 blocks
+		return rsl::max<rsl::size_t>(8, 16384 / (sizeof(Header) + blockSize(sizeClass)));
+	}
+
+	inline rsl::size_t ThreadCache::sizeClassOf(rsl::size_t bytes) {
+		rsl::size_t sizeClass = 0;
+		while (blockSize(sizeClass) < bytes)
+			++sizeClass;
+		return sizeClass;
+	}
+
+	inline bool ThreadCache::refill(rsl::size_t sizeClass) {
+		FreeList& freeList = freeLists[sizeClass];
+		Depot& depot = depots[sizeClass];
+		{
+			std::lock_guard<std::mutex> lock(depot.mutex);
+			if (depot.batches != nullptr) {
+				Block* batch = depot.batches;
+				depot.batches = batch->nextBatch;
+				freeList.head = batch;
+				freeList.count = headerOf(batch)->bytes;
+				return true;
+			}
+		}
+		// depot is empty, carve a new batch out of one heap allocation
+		const rsl::size_t stride = sizeof(Header) + blockSize(sizeClass);
+		const rsl::size_t count = batchSize(sizeClass);
+		auto* memory = static_cast<unsigned char*>(RSL_mm_ALLOC(stride * count));
+		if (memory == nullptr)
+			return false;
+		for (rsl::size_t index = count; index > 0; --index) {
+			auto* header = reinterpret_cast<Header*>(memory + stride * (index - 1));
+			header->sizeClass = sizeClass;
+			auto* block = reinterpret_cast<Block*>(header + 1);
+			block->next = freeList.head;
+			freeList.head = block;
+		}
+		freeList.count = count;
+		return true;
+	}
+
+	inline void ThreadCache::release(rsl::size_t sizeClass, rsl::size_t count) {
+		FreeList& freeList = freeLists[sizeClass];
+		Block* batch = freeList.head;
+		Block* last = batch;
+		for (rsl::size_t index = 1; index < count; ++index)
+			last = last->next;
+		freeList.head = last->next;
+		freeList.count -= count;
+		last->next = nullptr;
+		headerOf(batch)->bytes = count;
+		Depot& depot = depots[sizeClass];
+		std::lock_guard<std::mutex> lock(depot.mutex);
+		batch->nextBatch = depot.batches;
+		depot.batches = batch;
+	}
+}
+
+#endif
+
+#endif //RSL_THREADCACHE_HPP
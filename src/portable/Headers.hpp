@@ -13,11 +13,22 @@
 
 #else
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <new>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include <atomic>
+#include <thread>
+#include <mutex>
 
 #endif
 
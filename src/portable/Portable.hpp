@@ -9,6 +9,22 @@
 
 #include "Headers.hpp"
 
+// vector instruction set used by the kernels in portable/Simd.hpp, define RSL_SIMD_DISABLE to force scalar code
+#ifndef RSL_SIMD_DISABLE
+#if defined(__AVX2__)
+#define RSL_SIMD_AVX2
+#elif defined(__SSE__) || defined(_M_X64)
+#define RSL_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RSL_SIMD_NEON
+#endif
+#endif
+
+// size concurrent containers pad their shared counters to, so producer and consumer do not share a line
+#ifndef RSL_CACHE_LINE_SIZE
+#define RSL_CACHE_LINE_SIZE 64
+#endif
+
 #ifdef ARDUINO
 
 #ifdef RSL_DEBUG_ENABLE
@@ -0,0 +1,92 @@
+//
+// Created by robcholz on 11/8/23.
+//
+#pragma once
+
+#ifndef RSL_SIMD_HPP
+#define RSL_SIMD_HPP
+
+#include <portable/Portable.hpp>
+
+#if defined(RSL_SIMD_AVX2)
+
+#include <immintrin.h>
+
+#elif defined(RSL_SIMD_SSE)
+
+#include <xmmintrin.h>
+
+#elif defined(RSL_SIMD_NEON)
+
+#include <arm_neon.h>
+
+#endif
+
+
+namespace rsl {
+	/**
+	 * @usage dot product of two arrays
+	 * @tparam T element type, float uses the vector kernel selected in Portable.hpp
+	 * @param a
+	 * @param b
+	 * @param length number of elements
+	 * @return sum of a[i] * b[i]
+	 */
+	template<typename T>
+	inline T dotProduct(const T* a, const T* b, rsl::size_t length) {
+		T sum{0};
+		for (rsl::size_t i = 0; i < length; ++i)
+			sum += a[i] * b[i];
+		return sum;
+	}
+
+	template<>
+	inline float dotProduct<float>(const float* a, const float* b, rsl::size_t length) {
+		rsl::size_t i = 0;
+		float sum = 0.f;
+#if defined(RSL_SIMD_AVX2)
+		__m256 acc0 = _mm256_setzero_ps();
+		__m256 acc1 = _mm256_setzero_ps();
+		for (; i + 16 <= length; i += 16) {
+#ifdef __FMA__
+			acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+			acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+#else
+			acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+			acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+#endif
+		}
+		acc0 = _mm256_add_ps(acc0, acc1);
+		__m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+		for (; i + 4 <= length; i += 4)
+			acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+		acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+		sum = _mm_cvtss_f32(acc);
+#elif defined(RSL_SIMD_SSE)
+		__m128 acc0 = _mm_setzero_ps();
+		__m128 acc1 = _mm_setzero_ps();
+		for (; i + 8 <= length; i += 8) {
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+			acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+		}
+		acc0 = _mm_add_ps(acc0, acc1);
+		for (; i + 4 <= length; i += 4)
+			acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+		acc0 = _mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+		sum = _mm_cvtss_f32(acc0);
+#elif defined(RSL_SIMD_NEON)
+		float32x4_t acc = vdupq_n_f32(0.f);
+		for (; i + 4 <= length; i += 4)
+			acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+		float32x2_t half = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+		sum = vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+		for (; i < length; ++i)
+			sum += a[i] * b[i];
+		return sum;
+	}
+}
+
+#endif //RSL_SIMD_HPP
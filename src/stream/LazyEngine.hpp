@@ -0,0 +1,139 @@
+//
+// Created by robcholz on 11/25/23.
+//
+#pragma once
+
+#ifndef RSL_LAZYENGINE_HPP
+#define RSL_LAZYENGINE_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Holds a filter engine in inline storage and only constructs it while it is engaged, so a Pipeline does
+	 * not keep the state of the filters it does not run up to date. nothing is allocated, copies are deep
+	 * @tparam ENGINE engine type, default constructible and copyable
+	 */
+	template<typename ENGINE>
+	class RSL_UNUSED LazyEngine {
+	public:
+		LazyEngine() = default;
+
+		LazyEngine(const LazyEngine& other);
+
+		LazyEngine& operator=(const LazyEngine& other);
+
+		~LazyEngine();
+
+		/**
+		 * @usage construct the engine if it is not engaged yet
+		 */
+		RSL_UNUSED void engage();
+
+		/**
+		 * @usage destroy the engine
+		 */
+		RSL_UNUSED void release();
+
+		RSL_NODISCARD bool isEngaged() const;
+
+		/**
+		 * @usage get the engine
+		 * @return the engine, nullptr if it is not engaged
+		 */
+		RSL_NODISCARD ENGINE* get();
+
+		RSL_NODISCARD const ENGINE* get() const;
+
+		ENGINE* operator->();
+
+		const ENGINE* operator->() const;
+
+	private:
+		alignas(ENGINE) unsigned char storage[sizeof(ENGINE)];
+		bool engaged{false};
+	};
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	LazyEngine<ENGINE>::LazyEngine(const LazyEngine& other) {
+		if (other.engaged) {
+			new(storage) ENGINE(*other.get());
+			engaged = true;
+		}
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	LazyEngine<ENGINE>& LazyEngine<ENGINE>::operator=(const LazyEngine& other) {
+		// guard self assignment
+		if (this == &other)
+			return *this;
+		if (!other.engaged)
+			release();
+		else if (engaged)
+			*get() = *other.get();
+		else {
+			new(storage) ENGINE(*other.get());
+			engaged = true;
+		}
+		return *this;
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	LazyEngine<ENGINE>::~LazyEngine() {
+		release();
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	void LazyEngine<ENGINE>::engage() {
+		if (engaged)
+			return;
+		new(storage) ENGINE();
+		engaged = true;
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	void LazyEngine<ENGINE>::release() {
+		if (!engaged)
+			return;
+		get()->~ENGINE();
+		engaged = false;
+	}
+
+	template<typename ENGINE>
+	RSL_NODISCARD
+	bool LazyEngine<ENGINE>::isEngaged() const {
+		return engaged;
+	}
+
+	template<typename ENGINE>
+	RSL_NODISCARD
+	ENGINE* LazyEngine<ENGINE>::get() {
+		return engaged ? reinterpret_cast<ENGINE*>(storage) : nullptr;
+	}
+
+	template<typename ENGINE>
+	RSL_NODISCARD
+	const ENGINE* LazyEngine<ENGINE>::get() const {
+		return engaged ? reinterpret_cast<const ENGINE*>(storage) : nullptr;
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	ENGINE* LazyEngine<ENGINE>::operator->() {
+		return get();
+	}
+
+	template<typename ENGINE>
+	RSL_UNUSED
+	const ENGINE* LazyEngine<ENGINE>::operator->() const {
+		return get();
+	}
+}
+
+#endif //RSL_LAZYENGINE_HPP
@@ -0,0 +1,252 @@
+//
+// Created by robcholz on 11/9/23.
+//
+#pragma once
+
+#ifndef RSL_MULTICHANNELPIPELINE_HPP
+#define RSL_MULTICHANNELPIPELINE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage The same filter over CHANNELS sensors at once. the state of all channels is kept in
+	 * structure of arrays layout (one array per quantity, indexed by channel), and every tick the
+	 * filter runs as a plain loop over the channels, which the compiler vectorises
+	 * @tparam T sample type
+	 * @tparam CHANNELS number of channels
+	 * @tparam CALC_T type the history and the outputs are kept in
+	 * @tparam DEFAULT_CAPACITY number of ticks kept as history
+	 * @attention filters behave like their Pipeline::Filter counterparts without feedback
+	 */
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T = float, rsl::size_t DEFAULT_CAPACITY = 10>
+	class RSL_UNUSED MultiChannelPipeline {
+	public:
+		class Filter;
+
+		using TickFunc = void (*)(MultiChannelPipeline* pipeline, const T* in);
+
+		static constexpr rsl::size_t RENORMALIZE_PERIOD = DEFAULT_CAPACITY * 16;
+	public:
+		MultiChannelPipeline();
+
+		RSL_UNUSED void filter(TickFunc tickFunc);
+
+		/**
+		 * @usage filter one tick of all channels
+		 * @param in CHANNELS samples, one per channel
+		 * @param out CHANNELS filtered samples, can be nullptr and read back with output()
+		 */
+		RSL_UNUSED void update(const T* in, CALC_T* out = nullptr);
+
+		/**
+		 * @usage set the measurement error and the process noise of Filter::kalmanFilter
+		 */
+		RSL_UNUSED void kalman(CALC_T measurementError, CALC_T processNoise);
+
+		RSL_NODISCARD const CALC_T* output() const;
+
+		RSL_NODISCARD const CALC_T& output(rsl::size_t channel) const;
+
+		RSL_UNUSED void empty();
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+		RSL_NODISCARD constexpr rsl::size_t channels() const;
+
+	private:
+		CALC_T history[DEFAULT_CAPACITY][CHANNELS]{}; // one row per tick
+		CALC_T sum[CHANNELS]{}; // sum of the history of each channel
+		CALC_T previous[CHANNELS]{}; // previous sample of each channel
+		CALC_T estimate[CHANNELS]{}; // filtered sample of each channel
+		CALC_T errorEstimate[CHANNELS]{};
+		CALC_T kalmanMeasurementError{2};
+		CALC_T kalmanProcessNoise{0.01};
+		rsl::size_t head{0};
+		rsl::size_t historyLength{0};
+		rsl::size_t sinceRenormalize{0};
+
+		TickFunc tickFunction{nullptr};
+		friend Filter;
+
+		void push(const T* in);
+	};
+
+	/**
+	 * @usage tick kernels that can be set by MultiChannelPipeline::filter()
+	 */
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	class MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::Filter {
+	public:
+		/**
+		 * @usage average of the last DEFAULT_CAPACITY samples of each channel
+		 */
+		static void average(MultiChannelPipeline* pipeline, const T* in);
+
+		/**
+		 * @usage ALPHA% of the sample plus (100 - ALPHA)% of the previous sample
+		 */
+		template<short ALPHA>
+		static void IIR(MultiChannelPipeline* pipeline, const T* in);
+
+		/**
+		 * @usage scalar kalman filter per channel, see kalman()
+		 */
+		static void kalmanFilter(MultiChannelPipeline* pipeline, const T* in);
+
+		/**
+		 * @usage the previous sample if the sample jumps more than MAX_DIFFERENCE away from it
+		 */
+		template<const T MAX_DIFFERENCE>
+		static void constrainDiff(MultiChannelPipeline* pipeline, const T* in);
+	};
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::MultiChannelPipeline() {
+		empty();
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::filter(TickFunc tickFunc) {
+		tickFunction = tickFunc;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::update(const T* in, CALC_T* out) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(tickFunction == nullptr, "No filter is set", return;);
+		push(in);
+		tickFunction(this, in);
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+			previous[channel] = static_cast<CALC_T>(in[channel]);
+		if (out != nullptr) {
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+				out[channel] = estimate[channel];
+		}
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::kalman(CALC_T measurementError, CALC_T processNoise) {
+		kalmanMeasurementError = measurementError;
+		kalmanProcessNoise = processNoise;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	const CALC_T* MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::output() const {
+		return estimate;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	const CALC_T& MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::output(rsl::size_t channel) const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(channel >= CHANNELS, "Channel out of range", return estimate[0];);
+		return estimate[channel];
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::empty() {
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+			sum[channel] = CALC_T{0};
+			previous[channel] = CALC_T{0};
+			estimate[channel] = CALC_T{0};
+			errorEstimate[channel] = kalmanMeasurementError;
+		}
+		head = 0;
+		historyLength = 0;
+		sinceRenormalize = 0;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	bool MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::isEmpty() const {
+		return (historyLength == 0);
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	rsl::size_t MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::length() const {
+		return historyLength;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	constexpr rsl::size_t MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::capacity() const {
+		return DEFAULT_CAPACITY;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	constexpr rsl::size_t MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::channels() const {
+		return CHANNELS;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::push(const T* in) {
+		RSL_COMPILETIME_BOUND_CHECK(CHANNELS > 0 && DEFAULT_CAPACITY > 0, "Channels and capacity must be larger than 0.");
+		CALC_T* row = history[head];
+		if (historyLength == DEFAULT_CAPACITY) {
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+				sum[channel] -= row[channel];
+		} else {
+			++historyLength;
+		}
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+			row[channel] = static_cast<CALC_T>(in[channel]);
+			sum[channel] += row[channel];
+		}
+		head = (head + 1 == DEFAULT_CAPACITY) ? 0 : head + 1;
+		if constexpr (std::is_floating_point_v<CALC_T>) {
+			// recompute the sums now and then, so rounding error does not build up
+			if (++sinceRenormalize >= RENORMALIZE_PERIOD) {
+				sinceRenormalize = 0;
+				for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+					sum[channel] = CALC_T{0};
+				for (rsl::size_t tick = 0; tick < historyLength; ++tick) {
+					for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+						sum[channel] += history[tick][channel];
+				}
+			}
+		}
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::Filter::average(MultiChannelPipeline* pipeline, RSL_UNUSED const T* in) {
+		// push() has already added the tick to the sums
+		const CALC_T length = static_cast<CALC_T>(pipeline->historyLength);
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+			pipeline->estimate[channel] = pipeline->sum[channel] / length;
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	template<short ALPHA>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::Filter::IIR(MultiChannelPipeline* pipeline, const T* in) {
+		constexpr CALC_T WEIGHT = static_cast<CALC_T>(ALPHA) / static_cast<CALC_T>(100);
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+			pipeline->estimate[channel] = WEIGHT * static_cast<CALC_T>(in[channel]) + (CALC_T{1} - WEIGHT) * pipeline->previous[channel];
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::Filter::kalmanFilter(MultiChannelPipeline* pipeline, const T* in) {
+		const CALC_T measurementError = pipeline->kalmanMeasurementError;
+		const CALC_T processNoise = pipeline->kalmanProcessNoise;
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+			CALC_T prevEstimate = pipeline->estimate[channel];
+			CALC_T gain = pipeline->errorEstimate[channel] / (pipeline->errorEstimate[channel] + measurementError);
+			CALC_T current = prevEstimate + gain * (static_cast<CALC_T>(in[channel]) - prevEstimate);
+			pipeline->errorEstimate[channel] = (CALC_T{1} - gain) * pipeline->errorEstimate[channel] + rsl::fabs(prevEstimate - current) * processNoise;
+			pipeline->estimate[channel] = current;
+		}
+	}
+
+	template<typename T, rsl::size_t CHANNELS, typename CALC_T, rsl::size_t DEFAULT_CAPACITY>
+	template<const T MAX_DIFFERENCE>
+	void MultiChannelPipeline<T, CHANNELS, CALC_T, DEFAULT_CAPACITY>::Filter::constrainDiff(MultiChannelPipeline* pipeline, const T* in) {
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+			CALC_T sample = static_cast<CALC_T>(in[channel]);
+			CALC_T prevSample = pipeline->previous[channel];
+			pipeline->estimate[channel] = rsl::abs(sample - prevSample) > static_cast<CALC_T>(MAX_DIFFERENCE) ? prevSample : sample;
+		}
+	}
+}
+
+#endif //RSL_MULTICHANNELPIPELINE_HPP
@@ -8,24 +8,48 @@
 
 #include <Internal.hpp>
 #include <utils/Utils.hpp>
-#include "container/base/StaticList.hpp"
 #include "container/base/StaticArray.hpp"
+#include "container/base/StaticRingBuffer.hpp"
 #include "container/Deque.hpp"
+#include "stream/SlidingMedian.hpp"
+#include "stream/SlidingAverage.hpp"
+#include "stream/LazyEngine.hpp"
 
 
 namespace rsl {
-	template<typename T, typename CALC_T=float, typename OUT_T=float, rsl::size_t DEFAULT_CAPACITY = 10,typename CONTAINER=Deque<T, DEFAULT_CAPACITY, StaticList<T, DEFAULT_CAPACITY>>>
+	template<typename T, typename CALC_T=float, typename OUT_T=float, rsl::size_t DEFAULT_CAPACITY = 10,typename CONTAINER=Deque<T, DEFAULT_CAPACITY, StaticRingBuffer<T, DEFAULT_CAPACITY>>>
 	class Pipeline {
 	public:
 		class Filter;
 
 		using FilterFunc = CALC_T (*)(const Pipeline* pipeline);
+		/**
+		 * @usage block kernel of a filter, must give the same outputs and leave the pipeline in the same
+		 * state as n calls of add() and update() with its FilterFunc
+		 */
+		using BlockFunc = void (*)(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
 	public:
 		RSL_UNUSED void add(const T& element);
 
 		RSL_UNUSED void filter(FilterFunc filterFunc);
 
-		RSL_UNUSED const OUT_T& output();
+		/**
+		 * @usage set a filter together with its block kernel, e.g. filter(Filter::IIR<50>, Filter::IIRBlock<50>)
+		 * @param filterFunc per sample filter
+		 * @param blockFunc block kernel used by process()
+		 */
+		RSL_UNUSED void filter(FilterFunc filterFunc, BlockFunc blockFunc);
+
+		/**
+		 * @usage filter a block of samples, same as calling add(), update() and output() for each of them
+		 * @param in n input samples
+		 * @param out n filtered samples
+		 * @param n
+		 * @attention in and out must not overlap. the block kernel is skipped when feedback is on
+		 */
+		RSL_UNUSED void process(const T* in, OUT_T* out, rsl::size_t n);
+
+		RSL_UNUSED OUT_T output() const;
 
 		RSL_UNUSED void empty();
 
@@ -39,18 +63,105 @@ namespace rsl {
 
 		RSL_NODISCARD rsl::size_t capacity() const;
 
+		/**
+		 * @usage get a view of the samples in the window, oldest first, nothing is copied
+		 * @return the view, invalidated by the next update()
+		 */
+		RSL_NODISCARD RingSpan<const T> window() const;
+
 	private:
 		CONTAINER container;
+		// advanced by the filters through const Pipeline*, the same as kalmanErrorEstimate
+		mutable LazyEngine<SlidingMedian<T, DEFAULT_CAPACITY>> medianWindow; // engaged while Filter::median is selected
+		mutable LazyEngine<SlidingAverage<T, CALC_T, DEFAULT_CAPACITY>> averageWindow; // engaged while Filter::average or Filter::medianAverage is selected
 
 		T value{0}, prevValue{0};
 		T valueEst{0}, prevValueEst{0};
 		T commPreValue{0};
-		bool dataFeedback;
+		mutable float kalmanErrorEstimate{2}; // est_e of Filter::kalmanFilter, kept per pipeline
+		bool dataFeedback{false};
 
-		FilterFunc filterFunction;
+		FilterFunc filterFunction{nullptr};
+		BlockFunc blockFunction{nullptr};
 		friend Filter;
 
-		void addAscending(const T& element);
+		void advance(const T* in, rsl::size_t n, const T& prevEstimate, const T& estimate);
+
+		// the per sample path of a block kernel whose engine is not engaged, filterFunc instead of filterFunction
+		void advance(FilterFunc filterFunc, const T* in, OUT_T* out, rsl::size_t n);
+
+		void engage(FilterFunc filterFunc);
+
+		template<typename ENGINE>
+		void engage(LazyEngine<ENGINE>& engine, bool needed);
+	};
+
+	/**
+	 * @usage filters that can be set by Pipeline::filter(), they are defined in stream/filter
+	 */
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	class Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter {
+	public:
+		template<const T MAX_DIFFERENCE>
+		static CALC_T constrainDiff(const Pipeline* pipeline);
+
+		template<const T MAX_DIFFERENCE>
+		static void constrainDiffBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
+
+		/**
+		 * @usage median of the last DEFAULT_CAPACITY samples, O(log n) per sample
+		 * @attention its engine is started by filter() and advanced by every call, with feedback on the window holds the
+		 * previous estimates. without the engine, e.g. from a custom FilterFunc, a sorted copy of the window is used
+		 */
+		static CALC_T median(const Pipeline* pipeline);
+
+		static void medianBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
+
+		/**
+		 * @usage average of the last DEFAULT_CAPACITY samples, O(1) per sample
+		 * @attention its engine is started by filter() and advanced by every call, with feedback on the window holds the
+		 * previous estimates. without the engine, e.g. from a custom FilterFunc, the window is summed, O(n) per sample
+		 */
+		static CALC_T average(const Pipeline* pipeline);
+
+		static void averageBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
+
+		/**
+		 * @usage average of the last DEFAULT_CAPACITY samples without the minimum and the maximum, O(1) per sample
+		 * @attention its engine is started by filter() and advanced by every call, with feedback on the window holds the
+		 * previous estimates. without the engine, e.g. from a custom FilterFunc, the window is summed, O(n) per sample
+		 */
+		static CALC_T medianAverage(const Pipeline* pipeline);
+
+		static void medianAverageBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
+
+		template<const T MAX_DIFFERENCE>
+		static CALC_T constrainedAverage(const Pipeline* pipeline);
+
+		template<short ALPHA>
+		static CALC_T IIR(const Pipeline* pipeline);
+
+		template<short ALPHA>
+		static void IIRBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n);
+
+		static CALC_T weightedAverage(const Pipeline* pipeline);
+
+		/**
+		 * @usage weighted sum of the window, the weights are ordered oldest sample first
+		 * @attention a window longer than the weights only uses its newest weights.length() samples, the default table has 10
+		 */
+		static CALC_T weightedAverage(const Pipeline* pipeline, const StaticArray<float, DEFAULT_CAPACITY>& weights);
+
+		static CALC_T jitterFilter(const Pipeline* pipeline);
+
+		/**
+		 * @attention not implemented yet, selecting it does not compile
+		 */
+		static CALC_T constrainedJitter(const Pipeline* pipeline) = delete;
+
+		static CALC_T kalmanFilter(const Pipeline* pipeline);
+
+		static CALC_T kalmanFilter(const Pipeline* pipeline, float mea_e, float& est_e, float q);
 	};
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
@@ -63,33 +174,69 @@ namespace rsl {
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
 	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::filter(Pipeline::FilterFunc filterFunc) {
+		engage(filterFunc);
 		filterFunction = filterFunc;
+		blockFunction = nullptr;
 	}
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-	const OUT_T& Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::output() {
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::filter(Pipeline::FilterFunc filterFunc, Pipeline::BlockFunc blockFunc) {
+		engage(filterFunc);
+		filterFunction = filterFunc;
+		blockFunction = blockFunc;
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::process(const T* in, OUT_T* out, rsl::size_t n) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(filterFunction == nullptr, "No filter is set", return;);
+		// kernels fill the container with the input, so they only cover the non-feedback case
+		if (blockFunction != nullptr && !dataFeedback && n >= 2) {
+			blockFunction(this, in, out, n);
+			return;
+		}
+		for (rsl::size_t i = 0; i < n; ++i) {
+			add(in[i]);
+			update();
+			out[i] = output();
+		}
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	OUT_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::output() const {
 		return static_cast<OUT_T>(valueEst);
 	}
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
 	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::empty() {
 		container.empty();
-		value(0);
-		prevValue = 0;
-		valueEst(0);
-		prevValueEst = 0;
+		if (medianWindow.isEngaged())
+			medianWindow->empty();
+		if (averageWindow.isEngaged())
+			averageWindow->empty();
+		value = T{0};
+		prevValue = T{0};
+		valueEst = T{0};
+		prevValueEst = T{0};
+		commPreValue = T{0};
+		kalmanErrorEstimate = 2;
 	}
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
 	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::update() {
-		RSL_COMPILETIME_BOUND_CHECK(filterFunction != nullptr, "");
+		RSL_RUNTIME_BOUND_CHECK_ARG(filterFunction == nullptr, "No filter is set", return;);
 		if (container.length() == DEFAULT_CAPACITY)
 			container.pop();
 		valueEst = filterFunction(this);
-		if (dataFeedback)
-			addAscending(valueEst);
-		else
-			addAscending(value);
+		if (dataFeedback) {
+			container.add(valueEst);
+			// the engines saw the raw sample, they hold the estimate from now on, the same as the container
+			if (medianWindow.isEngaged())
+				medianWindow->replaceBack(valueEst);
+			if (averageWindow.isEngaged())
+				averageWindow->replaceBack(valueEst);
+		} else {
+			container.add(value);
+		}
 	}
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
@@ -113,19 +260,68 @@ namespace rsl {
 	}
 
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::addAscending(const T& element) {
-		if (container.length() == 0) {
-			container.add(element);
+	RingSpan<const T> Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::window() const {
+		return container.span();
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::advance(const T* in, rsl::size_t n, const T& prevEstimate, const T& estimate) {
+		// state n >= 2 calls of add() and update() leave behind, only the last DEFAULT_CAPACITY inputs stay in the container
+		prevValue = in[n - 2];
+		value = in[n - 1];
+		commPreValue = in[n - 2];
+		prevValueEst = prevEstimate;
+		valueEst = estimate;
+		for (rsl::size_t i = n > DEFAULT_CAPACITY ? n - DEFAULT_CAPACITY : 0; i < n; ++i) {
+			if (container.length() == DEFAULT_CAPACITY)
+				container.pop();
+			container.add(in[i]);
+		}
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::advance(Pipeline::FilterFunc filterFunc, const T* in, OUT_T* out, rsl::size_t n) {
+		for (rsl::size_t i = 0; i < n; ++i) {
+			add(in[i]);
+			if (container.length() == DEFAULT_CAPACITY)
+				container.pop();
+			valueEst = filterFunc(this);
+			container.add(value);
+			out[i] = output();
+		}
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::engage(Pipeline::FilterFunc filterFunc) {
+		engage(medianWindow, filterFunc == &Filter::median);
+		engage(averageWindow, filterFunc == &Filter::average || filterFunc == &Filter::medianAverage);
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	template<typename ENGINE>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::engage(LazyEngine<ENGINE>& engine, bool needed) {
+		if (!needed) {
+			engine.release();
 			return;
 		}
-		static rsl::size_t index;
-		index = 0;
-		auto it = container.begin();
-		while (it != container.end() && element > *it)
-			++it;
-		container.insert(it, element);
+		if (engine.isEngaged())
+			return;
+		engine.engage();
+		// start from the samples already in the window, so switching filters mid stream keeps the history
+		for (const T& sample: window())
+			engine->add(sample);
 	}
 }
 
+#include "stream/filter/ConstrainFilter.hpp"
+#include "stream/filter/MedianFilter.hpp"
+#include "stream/filter/AverageFilter.hpp"
+#include "stream/filter/MedianAverageFilter.hpp"
+#include "stream/filter/ConstrainedAverageFilter.hpp"
+#include "stream/filter/IIRFilter.hpp"
+#include "stream/filter/WeightedAverageFilter.hpp"
+#include "stream/filter/JitterFilter.hpp"
+#include "stream/filter/KalmanFilter.hpp"
+
 #endif //RSL_PIPELINE_HPP
 
@@ -0,0 +1,265 @@
+//
+// Created by robcholz on 11/6/23.
+//
+#pragma once
+
+#ifndef RSL_SLIDINGAVERAGE_HPP
+#define RSL_SLIDINGAVERAGE_HPP
+
+#include <Internal.hpp>
+#include "container/base/StaticRingBuffer.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage Average of the last WINDOW_SIZE samples, kept as a running sum that is only updated by
+	 * the entering and the leaving sample. minimum and maximum are kept in monotonic queues, so the
+	 * trimmed average is O(1) as well
+	 * @tparam T element type
+	 * @tparam CALC_T type the sum is accumulated in
+	 * @tparam WINDOW_SIZE number of samples the average is taken over
+	 * @attention for floating point CALC_T the sum is compensated (Kahan) and recomputed from the
+	 * window every RENORMALIZE_PERIOD samples, so rounding error does not build up over time
+	 */
+	template<typename T, typename CALC_T = float, rsl::size_t WINDOW_SIZE = 10>
+	class RSL_UNUSED SlidingAverage {
+	public:
+		static constexpr rsl::size_t RENORMALIZE_PERIOD = WINDOW_SIZE * 16;
+
+		SlidingAverage() = default;
+
+		/**
+		 * @usage add a sample and get the average of the window
+		 * @param element new sample, the oldest sample is evicted if the window is full
+		 * @return the average of the window after adding the sample
+		 */
+		RSL_UNUSED CALC_T filter(const T& element);
+
+		/**
+		 * @usage add a sample, the oldest sample is evicted if the window is full
+		 * @param element
+		 */
+		RSL_UNUSED void add(const T& element);
+
+		/**
+		 * @usage replace the newest sample
+		 * @param element
+		 * @attention O(1) if the newest sample stays the newest minimum and maximum candidate, the queues
+		 * are rebuilt from the window otherwise. operation will be ignored if the window is empty
+		 */
+		RSL_UNUSED void replaceBack(const T& element);
+
+		/**
+		 * @usage get the average of the window
+		 * @return the average, 0 if the window is empty
+		 */
+		RSL_NODISCARD CALC_T average() const;
+
+		/**
+		 * @usage get the average of the window without its minimum and maximum
+		 * @return the trimmed average, the plain average if there are less than 3 samples
+		 */
+		RSL_NODISCARD CALC_T trimmedAverage() const;
+
+		RSL_NODISCARD CALC_T sum() const;
+
+		RSL_NODISCARD const T& minimum() const;
+
+		RSL_NODISCARD const T& maximum() const;
+
+		/**
+		 * @usage empty the window
+		 */
+		RSL_UNUSED void empty();
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+	private:
+		static constexpr bool COMPENSATED = std::is_floating_point_v<CALC_T>;
+
+		StaticRingBuffer<T, WINDOW_SIZE> samples;
+		StaticRingBuffer<T, WINDOW_SIZE> minimums; // ascending, front is the minimum
+		StaticRingBuffer<T, WINDOW_SIZE> maximums; // descending, front is the maximum
+		CALC_T runningSum{0};
+		CALC_T compensation{0};
+		rsl::size_t sinceRenormalize{0};
+
+		void accumulate(CALC_T value);
+
+		void pushMinimum(const T& element);
+
+		void pushMaximum(const T& element);
+
+		void renormalize();
+	};
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	CALC_T SlidingAverage<T, CALC_T, WINDOW_SIZE>::filter(const T& element) {
+		add(element);
+		return average();
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::add(const T& element) {
+		RSL_COMPILETIME_BOUND_CHECK(WINDOW_SIZE > 0, "Window size must be larger than 0.");
+		if (samples.isFull()) {
+			const T& oldest = samples.front();
+			// equal samples are all kept in the queues, so the front is the oldest one of them
+			if (minimums.front() == oldest)
+				minimums.popFront();
+			if (maximums.front() == oldest)
+				maximums.popFront();
+			accumulate(-static_cast<CALC_T>(oldest));
+			samples.popFront();
+		}
+		samples.addBack(element);
+		accumulate(static_cast<CALC_T>(element));
+		pushMinimum(element);
+		pushMaximum(element);
+		if constexpr (COMPENSATED) {
+			if (++sinceRenormalize >= RENORMALIZE_PERIOD)
+				renormalize();
+		}
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::replaceBack(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(samples.isEmpty(), "Window is empty, replaceBack failed", return;);
+		T& newest = samples.back();
+		accumulate(-static_cast<CALC_T>(newest));
+		accumulate(static_cast<CALC_T>(element));
+		// the newest sample is the back of both queues. a smaller one only drops more of the minimums,
+		// a larger one needs the minimums it dropped back, which only the window still has
+		bool larger = newest < element;
+		bool smaller = element < newest;
+		newest = element;
+		if (larger) {
+			minimums.empty();
+			for (const T& sample: samples)
+				pushMinimum(sample);
+		} else {
+			minimums.popBack();
+			pushMinimum(element);
+		}
+		if (smaller) {
+			maximums.empty();
+			for (const T& sample: samples)
+				pushMaximum(sample);
+		} else {
+			maximums.popBack();
+			pushMaximum(element);
+		}
+		if constexpr (COMPENSATED) {
+			if (++sinceRenormalize >= RENORMALIZE_PERIOD)
+				renormalize();
+		}
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	CALC_T SlidingAverage<T, CALC_T, WINDOW_SIZE>::average() const {
+		if (samples.isEmpty())
+			return CALC_T{0};
+		return runningSum / static_cast<CALC_T>(samples.length());
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	CALC_T SlidingAverage<T, CALC_T, WINDOW_SIZE>::trimmedAverage() const {
+		if (samples.length() < 3)
+			return average();
+		CALC_T trimmed = runningSum - static_cast<CALC_T>(minimums.front()) - static_cast<CALC_T>(maximums.front());
+		return trimmed / static_cast<CALC_T>(samples.length() - 2);
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	CALC_T SlidingAverage<T, CALC_T, WINDOW_SIZE>::sum() const {
+		return runningSum;
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	const T& SlidingAverage<T, CALC_T, WINDOW_SIZE>::minimum() const {
+		return minimums.front();
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	const T& SlidingAverage<T, CALC_T, WINDOW_SIZE>::maximum() const {
+		return maximums.front();
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::empty() {
+		samples.empty();
+		minimums.empty();
+		maximums.empty();
+		runningSum = CALC_T{0};
+		compensation = CALC_T{0};
+		sinceRenormalize = 0;
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	bool SlidingAverage<T, CALC_T, WINDOW_SIZE>::isEmpty() const {
+		return samples.isEmpty();
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	rsl::size_t SlidingAverage<T, CALC_T, WINDOW_SIZE>::length() const {
+		return samples.length();
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	constexpr rsl::size_t SlidingAverage<T, CALC_T, WINDOW_SIZE>::capacity() const {
+		return WINDOW_SIZE;
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::accumulate(CALC_T value) {
+		if constexpr (COMPENSATED) {
+			CALC_T corrected = value - compensation;
+			CALC_T next = runningSum + corrected;
+			compensation = (next - runningSum) - corrected;
+			runningSum = next;
+		} else {
+			runningSum += value;
+		}
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::pushMinimum(const T& element) {
+		while (!minimums.isEmpty() && element < minimums.back())
+			minimums.popBack();
+		minimums.addBack(element);
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::pushMaximum(const T& element) {
+		while (!maximums.isEmpty() && maximums.back() < element)
+			maximums.popBack();
+		maximums.addBack(element);
+	}
+
+	template<typename T, typename CALC_T, rsl::size_t WINDOW_SIZE>
+	void SlidingAverage<T, CALC_T, WINDOW_SIZE>::renormalize() {
+		runningSum = CALC_T{0};
+		compensation = CALC_T{0};
+		sinceRenormalize = 0;
+		for (const T& sample: samples)
+			accumulate(static_cast<CALC_T>(sample));
+	}
+}
+
+#endif //RSL_SLIDINGAVERAGE_HPP
@@ -0,0 +1,249 @@
+//
+// Created by robcholz on 11/5/23.
+//
+#pragma once
+
+#ifndef RSL_SLIDINGMEDIAN_HPP
+#define RSL_SLIDINGMEDIAN_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Median of the last WINDOW_SIZE samples, kept in two indexed heaps over a fixed pool.
+	 * adding a sample evicts the oldest one in O(log n), the median is read in O(1)
+	 * @tparam T element type
+	 * @tparam WINDOW_SIZE number of samples the median is taken over
+	 * @attention for an even number of samples the upper median is returned, same as sorted[length / 2]
+	 */
+	template<typename T, rsl::size_t WINDOW_SIZE = 10>
+	class RSL_UNUSED SlidingMedian {
+	public:
+		SlidingMedian() = default;
+
+		/**
+		 * @usage add a sample and get the median of the window
+		 * @param element new sample, the oldest sample is evicted if the window is full
+		 * @return the median of the window after adding the sample
+		 */
+		RSL_UNUSED const T& filter(const T& element);
+
+		/**
+		 * @usage add a sample, the oldest sample is evicted if the window is full
+		 * @param element
+		 */
+		RSL_UNUSED void add(const T& element);
+
+		/**
+		 * @usage replace the newest sample, O(log n)
+		 * @param element
+		 * @attention operation will be ignored if the window is empty
+		 */
+		RSL_UNUSED void replaceBack(const T& element);
+
+		/**
+		 * @usage get the median of the window
+		 * @return the median, the default value of T if the window is empty
+		 */
+		RSL_NODISCARD const T& median() const;
+
+		/**
+		 * @usage empty the window
+		 */
+		RSL_UNUSED void empty();
+
+		RSL_NODISCARD bool isEmpty() const;
+
+		RSL_NODISCARD rsl::size_t length() const;
+
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+	private:
+		static constexpr rsl::size_t LOW_CAPACITY = WINDOW_SIZE / 2 + 1;
+		static constexpr rsl::size_t HIGH_CAPACITY = (WINDOW_SIZE + 1) / 2 + 1;
+
+		T samples[WINDOW_SIZE]{}; // arrival order, indexed by slot
+		rsl::size_t position[WINDOW_SIZE]{}; // index of each slot inside its heap
+		bool inLow[WINDOW_SIZE]{}; // which heap each slot lives in
+		rsl::size_t low[LOW_CAPACITY]{}; // max-heap of slots, the smaller half
+		rsl::size_t high[HIGH_CAPACITY]{}; // min-heap of slots, the larger half, high[0] is the median
+		rsl::size_t lowLength{0};
+		rsl::size_t highLength{0};
+		rsl::size_t oldest{0};
+		rsl::size_t sampleLength{0};
+		inline static T defaultValue{0};
+
+		bool before(rsl::size_t slotA, rsl::size_t slotB, bool isLow) const;
+
+		void push(rsl::size_t slot, bool isLow);
+
+		rsl::size_t popTop(bool isLow);
+
+		void erase(rsl::size_t slot);
+
+		void siftUp(rsl::size_t index, bool isLow);
+
+		void siftDown(rsl::size_t index, bool isLow);
+
+		void place(rsl::size_t index, rsl::size_t slot, bool isLow);
+
+		void rebalance();
+	};
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	const T& SlidingMedian<T, WINDOW_SIZE>::filter(const T& element) {
+		add(element);
+		return median();
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingMedian<T, WINDOW_SIZE>::add(const T& element) {
+		RSL_COMPILETIME_BOUND_CHECK(WINDOW_SIZE > 0, "Window size must be larger than 0.");
+		rsl::size_t slot;
+		if (sampleLength == WINDOW_SIZE) {
+			slot = oldest;
+			erase(slot);
+			oldest = (oldest + 1) % WINDOW_SIZE;
+		} else {
+			slot = (oldest + sampleLength) % WINDOW_SIZE;
+			++sampleLength;
+		}
+		samples[slot] = element;
+		push(slot, lowLength != 0 && element < samples[low[0]]);
+		rebalance();
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingMedian<T, WINDOW_SIZE>::replaceBack(const T& element) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(sampleLength == 0, "Window is empty, replaceBack failed", return;);
+		rsl::size_t slot = (oldest + sampleLength - 1) % WINDOW_SIZE;
+		erase(slot);
+		samples[slot] = element;
+		push(slot, lowLength != 0 && element < samples[low[0]]);
+		rebalance();
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	const T& SlidingMedian<T, WINDOW_SIZE>::median() const {
+		RSL_RUNTIME_BOUND_CHECK_ARG(highLength == 0, "Window is empty", return defaultValue;);
+		return samples[high[0]];
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_UNUSED
+	void SlidingMedian<T, WINDOW_SIZE>::empty() {
+		lowLength = 0;
+		highLength = 0;
+		oldest = 0;
+		sampleLength = 0;
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	bool SlidingMedian<T, WINDOW_SIZE>::isEmpty() const {
+		return (sampleLength == 0);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	rsl::size_t SlidingMedian<T, WINDOW_SIZE>::length() const {
+		return sampleLength;
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	RSL_NODISCARD
+	constexpr rsl::size_t SlidingMedian<T, WINDOW_SIZE>::capacity() const {
+		return WINDOW_SIZE;
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	bool SlidingMedian<T, WINDOW_SIZE>::before(rsl::size_t slotA, rsl::size_t slotB, bool isLow) const {
+		return isLow ? (samples[slotB] < samples[slotA]) : (samples[slotA] < samples[slotB]);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::push(rsl::size_t slot, bool isLow) {
+		rsl::size_t& heapLength = isLow ? lowLength : highLength;
+		inLow[slot] = isLow;
+		place(heapLength, slot, isLow);
+		++heapLength;
+		siftUp(heapLength - 1, isLow);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	rsl::size_t SlidingMedian<T, WINDOW_SIZE>::popTop(bool isLow) {
+		rsl::size_t slot = isLow ? low[0] : high[0];
+		erase(slot);
+		return slot;
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::erase(rsl::size_t slot) {
+		bool isLow = inLow[slot];
+		rsl::size_t* heap = isLow ? low : high;
+		rsl::size_t& heapLength = isLow ? lowLength : highLength;
+		rsl::size_t index = position[slot];
+		--heapLength;
+		if (index == heapLength)
+			return;
+		rsl::size_t moved = heap[heapLength];
+		place(index, moved, isLow);
+		siftUp(index, isLow);
+		siftDown(position[moved], isLow);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::siftUp(rsl::size_t index, bool isLow) {
+		rsl::size_t* heap = isLow ? low : high;
+		rsl::size_t slot = heap[index];
+		while (index > 0) {
+			rsl::size_t parent = (index - 1) / 2;
+			if (!before(slot, heap[parent], isLow))
+				break;
+			place(index, heap[parent], isLow);
+			index = parent;
+		}
+		place(index, slot, isLow);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::siftDown(rsl::size_t index, bool isLow) {
+		rsl::size_t* heap = isLow ? low : high;
+		rsl::size_t heapLength = isLow ? lowLength : highLength;
+		rsl::size_t slot = heap[index];
+		while (true) {
+			rsl::size_t child = index * 2 + 1;
+			if (child >= heapLength)
+				break;
+			if (child + 1 < heapLength && before(heap[child + 1], heap[child], isLow))
+				++child;
+			if (!before(heap[child], slot, isLow))
+				break;
+			place(index, heap[child], isLow);
+			index = child;
+		}
+		place(index, slot, isLow);
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::place(rsl::size_t index, rsl::size_t slot, bool isLow) {
+		(isLow ? low : high)[index] = slot;
+		position[slot] = index;
+	}
+
+	template<typename T, rsl::size_t WINDOW_SIZE>
+	void SlidingMedian<T, WINDOW_SIZE>::rebalance() {
+		// keep highLength == lowLength or lowLength + 1, so high[0] is sorted[length / 2]
+		while (highLength > lowLength + 1)
+			push(popTop(false), true);
+		while (lowLength > highLength)
+			push(popTop(true), false);
+	}
+}
+
+#endif //RSL_SLIDINGMEDIAN_HPP
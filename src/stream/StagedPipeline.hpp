@@ -0,0 +1,106 @@
+//
+// Created by robcholz on 11/7/23.
+//
+#pragma once
+
+#ifndef RSL_STAGEDPIPELINE_HPP
+#define RSL_STAGEDPIPELINE_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage Chain of filter stages composed at compile time, StagedPipeline<int, ConstrainStage<int, 50>, SlidingMedian<int, 64>, IIRStage<int>>.
+	 * every stage keeps its own state, the value is handed from stage to stage without a call through a pointer
+	 * @tparam T input type
+	 * @tparam STAGES stages in order, each has filter(const X&) returning the input of the next stage and empty()
+	 * @attention the output type is whatever the last stage returns
+	 */
+	template<typename T, typename... STAGES>
+	class RSL_UNUSED StagedPipeline {
+	public:
+		StagedPipeline() = default;
+
+		/**
+		 * @usage run a sample through all stages
+		 * @param element
+		 * @return output of the last stage
+		 */
+		RSL_UNUSED auto filter(const T& element);
+
+		/**
+		 * @usage run a block of samples through all stages
+		 * @param in n input samples
+		 * @param out n filtered samples
+		 * @param n
+		 */
+		template<typename OUT_T>
+		RSL_UNUSED void process(const T* in, OUT_T* out, rsl::size_t n);
+
+		/**
+		 * @usage empty every stage
+		 */
+		RSL_UNUSED void empty();
+
+		/**
+		 * @usage get a stage to configure or inspect it
+		 * @tparam INDEX position of the stage
+		 */
+		template<rsl::size_t INDEX>
+		RSL_NODISCARD auto& stage();
+
+		RSL_NODISCARD constexpr rsl::size_t stages() const;
+
+	private:
+		std::tuple<STAGES...> stageList;
+
+		template<rsl::size_t INDEX, typename VALUE>
+		auto run(const VALUE& value);
+	};
+
+	template<typename T, typename... STAGES>
+	RSL_UNUSED
+	auto StagedPipeline<T, STAGES...>::filter(const T& element) {
+		return run<0>(element);
+	}
+
+	template<typename T, typename... STAGES>
+	template<typename OUT_T>
+	RSL_UNUSED
+	void StagedPipeline<T, STAGES...>::process(const T* in, OUT_T* out, rsl::size_t n) {
+		for (rsl::size_t i = 0; i < n; ++i)
+			out[i] = static_cast<OUT_T>(run<0>(in[i]));
+	}
+
+	template<typename T, typename... STAGES>
+	RSL_UNUSED
+	void StagedPipeline<T, STAGES...>::empty() {
+		std::apply([](auto& ... stage) { (stage.empty(), ...); }, stageList);
+	}
+
+	template<typename T, typename... STAGES>
+	template<rsl::size_t INDEX>
+	RSL_NODISCARD
+	auto& StagedPipeline<T, STAGES...>::stage() {
+		RSL_COMPILETIME_BOUND_CHECK(INDEX < sizeof...(STAGES), "Stage index out of range.");
+		return std::get<INDEX>(stageList);
+	}
+
+	template<typename T, typename... STAGES>
+	RSL_NODISCARD
+	constexpr rsl::size_t StagedPipeline<T, STAGES...>::stages() const {
+		return sizeof...(STAGES);
+	}
+
+	template<typename T, typename... STAGES>
+	template<rsl::size_t INDEX, typename VALUE>
+	auto StagedPipeline<T, STAGES...>::run(const VALUE& value) {
+		if constexpr (INDEX == sizeof...(STAGES))
+			return value;
+		else
+			return run<INDEX + 1>(std::get<INDEX>(stageList).filter(value));
+	}
+}
+
+#endif //RSL_STAGEDPIPELINE_HPP
@@ -6,24 +6,36 @@
 #ifndef RSL_AVERAGEFILTER_HPP
 #define RSL_AVERAGEFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl {
-	template<typename T, typename CALC_T=float>
-	class AverageFilter {
-	public:
-		AverageFilter() = default;
 
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::average(const Pipeline* pipeline) {
+		if (pipeline->averageWindow.isEngaged())
+			return pipeline->averageWindow->filter(pipeline->value);
+		// not selected through filter(), e.g. called by a custom FilterFunc, sum the samples the engine would hold
+		CALC_T sum = static_cast<CALC_T>(pipeline->value);
+		RingSpan<const T> window = pipeline->window().last(DEFAULT_CAPACITY - 1);
+		for (const T& sample: window)
+			sum += static_cast<CALC_T>(sample);
+		return sum / static_cast<CALC_T>(window.length() + 1);
+	}
 
-		CALC_T filter(const T& data) {
-			sum = T{0};
-			for (const T& i: pipeline->container)
-				sum += i;
-			return sum / (DEFAULT_CAPACITY);
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::averageBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n) {
+		if (!pipeline->averageWindow.isEngaged()) {
+			pipeline->advance(&Filter::average, in, out, n);
+			return;
 		}
-
-	private:
-		T sum;
-	};
+		T prevEstimate = pipeline->valueEst, estimate = pipeline->valueEst;
+		for (rsl::size_t i = 0; i < n; ++i) {
+			prevEstimate = estimate;
+			estimate = static_cast<T>(pipeline->averageWindow->filter(in[i]));
+			out[i] = static_cast<OUT_T>(estimate);
+		}
+		pipeline->advance(in, n, prevEstimate, estimate);
+	}
 }
 
 #endif //RSL_AVERAGEFILTER_HPP
@@ -6,17 +6,32 @@
 #ifndef RSL_CONSTRAINFILTER_HPP
 #define RSL_CONSTRAINFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl{
-	class ConstrainFilter{
-		template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-		template<const T MAX_DIFFERENCE>
-		CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::constrainDiff(const Pipeline* pipeline) {
-			if (rsl::abs(pipeline->value - pipeline->commPreValue) > MAX_DIFFERENCE)
-				return pipeline->commPreValue;
-			return pipeline->value;
-		}
-	};
+
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	template<const T MAX_DIFFERENCE>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::constrainDiff(const Pipeline* pipeline) {
+		if (rsl::abs(pipeline->value - pipeline->commPreValue) > MAX_DIFFERENCE)
+			return pipeline->commPreValue;
+		return pipeline->value;
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	template<const T MAX_DIFFERENCE>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::constrainDiffBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n) {
+		// without feedback the previous value is the previous input, so every output is independent
+		T previous = pipeline->container.back();
+		out[0] = static_cast<OUT_T>(rsl::abs(in[0] - previous) > MAX_DIFFERENCE ? previous : in[0]);
+		for (rsl::size_t i = 1; i < n; ++i)
+			out[i] = static_cast<OUT_T>(rsl::abs(in[i] - in[i - 1]) > MAX_DIFFERENCE ? in[i - 1] : in[i]);
+		if (n > 2)
+			previous = in[n - 3];
+		T prevEstimate = rsl::abs(in[n - 2] - previous) > MAX_DIFFERENCE ? previous : in[n - 2];
+		T estimate = rsl::abs(in[n - 1] - in[n - 2]) > MAX_DIFFERENCE ? in[n - 2] : in[n - 1];
+		pipeline->advance(in, n, prevEstimate, estimate);
+	}
 }
 
 #endif //RSL_CONSTRAINFILTER_HPP
@@ -6,15 +6,30 @@
 #ifndef RSL_IIRFILTER_HPP
 #define RSL_IIRFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl{
-	class IIRFilter{
-		template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-		template<short ALPHA>
-		CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::IIR(const Pipeline* pipeline) {
-			return (ALPHA / 100.f) * pipeline->value + (1.0 - (ALPHA / 100.f)) * pipeline->commPreValue;
-		}
-	};
+
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	template<short ALPHA>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::IIR(const Pipeline* pipeline) {
+		return (ALPHA / 100.f) * pipeline->value + (1.0 - (ALPHA / 100.f)) * pipeline->commPreValue;
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	template<short ALPHA>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::IIRBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n) {
+		// without feedback the previous value is the previous input, so every output is independent
+		out[0] = static_cast<OUT_T>(static_cast<T>(static_cast<CALC_T>(
+				(ALPHA / 100.f) * in[0] + (1.0 - (ALPHA / 100.f)) * pipeline->container.back())));
+		for (rsl::size_t i = 1; i < n; ++i)
+			out[i] = static_cast<OUT_T>(static_cast<T>(static_cast<CALC_T>(
+					(ALPHA / 100.f) * in[i] + (1.0 - (ALPHA / 100.f)) * in[i - 1])));
+		T prevEstimate = static_cast<T>(static_cast<CALC_T>(
+				(ALPHA / 100.f) * in[n - 2] + (1.0 - (ALPHA / 100.f)) * (n > 2 ? in[n - 3] : pipeline->container.back())));
+		T estimate = static_cast<T>(static_cast<CALC_T>((ALPHA / 100.f) * in[n - 1] + (1.0 - (ALPHA / 100.f)) * in[n - 2]));
+		pipeline->advance(in, n, prevEstimate, estimate);
+	}
 }
 
 #endif //RSL_IIRFILTER_HPP
@@ -6,15 +6,15 @@
 #ifndef RSL_JITTERFILTER_HPP
 #define RSL_JITTERFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl{
-	class JitterFilter{
-		template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-		CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::jitterFilter(const Pipeline* pipeline) {
-			// oReminder
-		}
 
-	};
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::jitterFilter(const Pipeline* pipeline) {
+		// oReminder
+		return pipeline->value;
+	}
 }
 
 #endif //RSL_JITTERFILTER_HPP
@@ -6,26 +6,46 @@
 #ifndef RSL_MEDIANAVERAGEFILTER_HPP
 #define RSL_MEDIANAVERAGEFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl{
-	class MedianAverageFilter{
-		template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-		CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::medianAverage(const Pipeline* pipeline) {
-			static T sum;
-			static rsl::size_t length;
-			static rsl::size_t index;
-			length = pipeline->container.length();
-			sum = T{0};
-			index = 0;
-			for (const T& i: pipeline->container) {
-				if (index != 0 || index != length - 1)
-					sum += i;
-				++index;
-			}
-			return sum / (DEFAULT_CAPACITY - 2);
+
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::medianAverage(const Pipeline* pipeline) {
+		if (pipeline->averageWindow.isEngaged()) {
+			pipeline->averageWindow->add(pipeline->value);
+			return pipeline->averageWindow->trimmedAverage();
+		}
+		// not selected through filter(), e.g. called by a custom FilterFunc, sum the samples the engine would hold
+		CALC_T sum = static_cast<CALC_T>(pipeline->value);
+		T minimum = pipeline->value, maximum = pipeline->value;
+		RingSpan<const T> window = pipeline->window().last(DEFAULT_CAPACITY - 1);
+		for (const T& sample: window) {
+			sum += static_cast<CALC_T>(sample);
+			minimum = rsl::min(minimum, sample);
+			maximum = rsl::max(maximum, sample);
 		}
+		rsl::size_t length = window.length() + 1;
+		if (length < 3)
+			return sum / static_cast<CALC_T>(length);
+		return (sum - static_cast<CALC_T>(minimum) - static_cast<CALC_T>(maximum)) / static_cast<CALC_T>(length - 2);
+	}
 
-	};
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::medianAverageBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n) {
+		if (!pipeline->averageWindow.isEngaged()) {
+			pipeline->advance(&Filter::medianAverage, in, out, n);
+			return;
+		}
+		T prevEstimate = pipeline->valueEst, estimate = pipeline->valueEst;
+		for (rsl::size_t i = 0; i < n; ++i) {
+			prevEstimate = estimate;
+			pipeline->averageWindow->add(in[i]);
+			estimate = static_cast<T>(pipeline->averageWindow->trimmedAverage());
+			out[i] = static_cast<OUT_T>(estimate);
+		}
+		pipeline->advance(in, n, prevEstimate, estimate);
+	}
 }
 
 #endif //RSL_MEDIANAVERAGEFILTER_HPP
@@ -6,23 +6,43 @@
 #ifndef RSL_MEDIANFILTER_HPP
 #define RSL_MEDIANFILTER_HPP
 
+#include "stream/Pipeline.hpp"
 
-namespace rsl{
-	class MedianFilter{
-		ttemplate<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
-				CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::median(const Pipeline* pipeline) {
-			static rsl::size_t index;
-			static rsl::size_t length;
-			index = 0;
-			length = pipeline->container.length() / 2;
-			for (const T& i: pipeline->container) {
-				if (index == length)
-					return i;
-				++index;
-			}
-			return CALC_T{0}; // for static code analysis only
+
+namespace rsl {
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::median(const Pipeline* pipeline) {
+		if (pipeline->medianWindow.isEngaged())
+			return pipeline->medianWindow->filter(pipeline->value);
+		// not selected through filter(), e.g. called by a custom FilterFunc, sort the samples the engine would hold
+		T sorted[DEFAULT_CAPACITY];
+		rsl::size_t length = 0;
+		auto insert = [&sorted, &length](const T& sample) {
+			rsl::size_t index = rsl::upperBound(sorted, length, sample, [](const T& a, const T& b) { return a < b; });
+			rsl::moveRange(sorted + index + 1, sorted + index, length - index);
+			sorted[index] = sample;
+			++length;
+		};
+		for (const T& sample: pipeline->window().last(DEFAULT_CAPACITY - 1))
+			insert(sample);
+		insert(pipeline->value);
+		return sorted[length / 2];
+	}
+
+	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
+	void Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::medianBlock(Pipeline* pipeline, const T* in, OUT_T* out, rsl::size_t n) {
+		if (!pipeline->medianWindow.isEngaged()) {
+			pipeline->advance(&Filter::median, in, out, n);
+			return;
+		}
+		T prevEstimate = pipeline->valueEst, estimate = pipeline->valueEst;
+		for (rsl::size_t i = 0; i < n; ++i) {
+			prevEstimate = estimate;
+			estimate = static_cast<T>(static_cast<CALC_T>(pipeline->medianWindow->filter(in[i])));
+			out[i] = static_cast<OUT_T>(estimate);
 		}
-	};
+		pipeline->advance(in, n, prevEstimate, estimate);
+	}
 }
 
 #endif //RSL_MEDIANFILTER_HPP
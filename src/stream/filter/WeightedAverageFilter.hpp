@@ -6,6 +6,8 @@
 #ifndef RSL_WEIGHTEDAVERAGEFILTER_HPP
 #define RSL_WEIGHTEDAVERAGEFILTER_HPP
 
+#include "stream/Pipeline.hpp"
+
 
 namespace rsl{
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
@@ -17,14 +19,14 @@ namespace rsl{
 	template<typename T, typename CALC_T, typename OUT_T, rsl::size_t DEFAULT_CAPACITY, typename CONTAINER>
 	CALC_T Pipeline<T, CALC_T, OUT_T, DEFAULT_CAPACITY, CONTAINER>::Filter::weightedAverage(const Pipeline* pipeline,
 	                                                                                        const StaticArray<float, DEFAULT_CAPACITY>& weights) {
-		static T sum;
-		static rsl::size_t index;
-		sum = T{0};
-		index = 0;
-		for (const T& i: pipeline->container) {
-			sum += i * weights[index];
-			++index;
-		}
+		T sum{0};
+		rsl::size_t index = 0;
+		// windows longer than the weights table only use the newest weights.length() samples
+		RingSpan<const T> window = pipeline->window().last(weights.length());
+		for (const T& i: window.firstSpan())
+			sum += i * weights[index++];
+		for (const T& i: window.secondSpan())
+			sum += i * weights[index++];
 		return sum;
 	}
 
@@ -0,0 +1,54 @@
+//
+// Created by robcholz on 11/7/23.
+//
+#pragma once
+
+#ifndef RSL_CONSTRAINSTAGE_HPP
+#define RSL_CONSTRAINSTAGE_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage StagedPipeline stage that drops samples jumping more than MAX_DIFFERENCE away from the last accepted one
+	 * @tparam T element type
+	 * @tparam MAX_DIFFERENCE
+	 */
+	template<typename T, T MAX_DIFFERENCE>
+	class RSL_UNUSED ConstrainStage {
+	public:
+		/**
+		 * @usage filter a sample
+		 * @param element
+		 * @return the sample, or the last accepted sample if the jump is too large
+		 */
+		RSL_UNUSED const T& filter(const T& element);
+
+		RSL_UNUSED void empty();
+
+	private:
+		T accepted{0};
+		bool hasAccepted{false};
+	};
+
+	template<typename T, T MAX_DIFFERENCE>
+	RSL_UNUSED
+	const T& ConstrainStage<T, MAX_DIFFERENCE>::filter(const T& element) {
+		if (!hasAccepted || rsl::abs(element - accepted) <= MAX_DIFFERENCE) {
+			accepted = element;
+			hasAccepted = true;
+		}
+		return accepted;
+	}
+
+	template<typename T, T MAX_DIFFERENCE>
+	RSL_UNUSED
+	void ConstrainStage<T, MAX_DIFFERENCE>::empty() {
+		accepted = T{0};
+		hasAccepted = false;
+	}
+}
+
+#endif //RSL_CONSTRAINSTAGE_HPP
@@ -0,0 +1,92 @@
+//
+// Created by robcholz on 11/8/23.
+//
+#pragma once
+
+#ifndef RSL_FIRSTAGE_HPP
+#define RSL_FIRSTAGE_HPP
+
+#include <Internal.hpp>
+#include <portable/Simd.hpp>
+#include "container/base/StaticArray.hpp"
+
+
+namespace rsl {
+	/**
+	 * @usage StagedPipeline stage, FIR filter with TAPS coefficients. the history is kept twice in a row,
+	 * so the last TAPS samples are always contiguous and the dot product runs as one vector kernel
+	 * @tparam T element type
+	 * @tparam TAPS number of coefficients
+	 * @tparam CALC_T type the history and the coefficients are kept in, float uses the SIMD kernel
+	 * @attention coefficients are ordered oldest sample first, same as Pipeline::Filter::weightedAverage.
+	 * the history starts zeroed
+	 */
+	template<typename T, rsl::size_t TAPS, typename CALC_T = float>
+	class RSL_UNUSED FIRStage {
+	public:
+		FIRStage() = default;
+
+		explicit FIRStage(const StaticArray<CALC_T, TAPS>& coefficients);
+
+		/**
+		 * @usage set the coefficients
+		 * @param coefficients TAPS coefficients, oldest sample first
+		 */
+		RSL_UNUSED void taps(const CALC_T* coefficients);
+
+		/**
+		 * @usage filter a sample
+		 * @param element
+		 * @return dot product of the coefficients and the last TAPS samples
+		 */
+		RSL_UNUSED CALC_T filter(const T& element);
+
+		RSL_UNUSED void empty();
+
+		RSL_NODISCARD constexpr rsl::size_t capacity() const;
+
+	private:
+		CALC_T coefficientList[TAPS]{};
+		CALC_T history[TAPS * 2]{}; // history[head, head + TAPS) is the window, oldest first
+		rsl::size_t head{0};
+	};
+
+	template<typename T, rsl::size_t TAPS, typename CALC_T>
+	FIRStage<T, TAPS, CALC_T>::FIRStage(const StaticArray<CALC_T, TAPS>& coefficients) {
+		for (rsl::size_t i = 0; i < TAPS; ++i)
+			coefficientList[i] = coefficients[i];
+	}
+
+	template<typename T, rsl::size_t TAPS, typename CALC_T>
+	RSL_UNUSED
+	void FIRStage<T, TAPS, CALC_T>::taps(const CALC_T* coefficients) {
+		for (rsl::size_t i = 0; i < TAPS; ++i)
+			coefficientList[i] = coefficients[i];
+	}
+
+	template<typename T, rsl::size_t TAPS, typename CALC_T>
+	RSL_UNUSED
+	CALC_T FIRStage<T, TAPS, CALC_T>::filter(const T& element) {
+		RSL_COMPILETIME_BOUND_CHECK(TAPS > 0, "FIR needs at least one tap.");
+		history[head] = static_cast<CALC_T>(element);
+		history[head + TAPS] = static_cast<CALC_T>(element);
+		head = (head + 1 == TAPS) ? 0 : head + 1;
+		return rsl::dotProduct(history + head, coefficientList, TAPS);
+	}
+
+	template<typename T, rsl::size_t TAPS, typename CALC_T>
+	RSL_UNUSED
+	void FIRStage<T, TAPS, CALC_T>::empty() {
+		for (rsl::size_t i = 0; i < TAPS * 2; ++i)
+			history[i] = CALC_T{0};
+		head = 0;
+	}
+
+	template<typename T, rsl::size_t TAPS, typename CALC_T>
+	RSL_NODISCARD
+	constexpr rsl::size_t FIRStage<T, TAPS, CALC_T>::capacity() const {
+		return TAPS;
+	}
+}
+
+#endif //RSL_FIRSTAGE_HPP
@@ -0,0 +1,58 @@
+//
+// Created by robcholz on 11/7/23.
+//
+#pragma once
+
+#ifndef RSL_IIRSTAGE_HPP
+#define RSL_IIRSTAGE_HPP
+
+#include <Internal.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage StagedPipeline stage, first order low pass, output = ALPHA% * sample + (100 - ALPHA)% * last output
+	 * @tparam T element type
+	 * @tparam CALC_T type the output is calculated in
+	 * @tparam ALPHA weight of the new sample in percent
+	 */
+	template<typename T, typename CALC_T = float, short ALPHA = 50>
+	class RSL_UNUSED IIRStage {
+	public:
+		/**
+		 * @usage filter a sample, the first sample is passed through
+		 * @param element
+		 * @return the smoothed value
+		 */
+		RSL_UNUSED CALC_T filter(const T& element);
+
+		RSL_UNUSED void empty();
+
+	private:
+		static constexpr CALC_T WEIGHT = static_cast<CALC_T>(ALPHA) / static_cast<CALC_T>(100);
+
+		CALC_T estimate{0};
+		bool hasEstimate{false};
+	};
+
+	template<typename T, typename CALC_T, short ALPHA>
+	RSL_UNUSED
+	CALC_T IIRStage<T, CALC_T, ALPHA>::filter(const T& element) {
+		RSL_COMPILETIME_BOUND_CHECK(ALPHA >= 0 && ALPHA <= 100, "ALPHA must be between 0 and 100.");
+		if (hasEstimate)
+			estimate = WEIGHT * static_cast<CALC_T>(element) + (CALC_T{1} - WEIGHT) * estimate;
+		else
+			estimate = static_cast<CALC_T>(element);
+		hasEstimate = true;
+		return estimate;
+	}
+
+	template<typename T, typename CALC_T, short ALPHA>
+	RSL_UNUSED
+	void IIRStage<T, CALC_T, ALPHA>::empty() {
+		estimate = CALC_T{0};
+		hasEstimate = false;
+	}
+}
+
+#endif //RSL_IIRSTAGE_HPP
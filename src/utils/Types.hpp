@@ -7,17 +7,33 @@
 #define RSL_TYPES_HPP
 
 #include "container/base/StaticArray.hpp"
+#include "container/base/DynamicArray.hpp"
 #include "container/base/StaticList.hpp"
+#include "container/base/StaticRingBuffer.hpp"
+#include "container/base/DynamicRingBuffer.hpp"
+#include "container/base/SegmentedBuffer.hpp"
 #include "container/Deque.hpp"
 #include "container/Queue.hpp"
 #include "container/Stack.hpp"
+#include "container/FlatSet.hpp"
+#include "container/FlatMap.hpp"
+#include "container/PriorityQueue.hpp"
+#include "memory/InlineAllocator.hpp"
 
 
 namespace rsl {
+	/**
+	 * @usage DynamicArray that keeps up to INLINE_CAPACITY elements inside the object and only allocates from
+	 * ALLOCATOR once it grows past them
+	 */
+	template<typename T, rsl::size_t INLINE_CAPACITY = 8, typename ALLOCATOR = ByteAllocator<T>>
+	using SmallArray = DynamicArray<T, INLINE_CAPACITY, InlineAllocator<T, INLINE_CAPACITY, ALLOCATOR>>;
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
-	using StaticDeque = Deque<T, DEFAULT_CAPACITY, StaticArray<T, DEFAULT_CAPACITY>>;
+	using StaticDeque = Deque<T, DEFAULT_CAPACITY, StaticRingBuffer<T, DEFAULT_CAPACITY>>;
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
-	using DynamicDeque = Deque<T, DEFAULT_CAPACITY, DynamicArray<T, DEFAULT_CAPACITY>>;
+	using DynamicDeque = Deque<T, DEFAULT_CAPACITY, SegmentedBuffer<T, DEFAULT_CAPACITY>>;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
+	using DynamicRingDeque = Deque<T, DEFAULT_CAPACITY, DynamicRingBuffer<T, DEFAULT_CAPACITY>>;
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
 	using StaticQueue = Queue<T, DEFAULT_CAPACITY, StaticList<T, DEFAULT_CAPACITY>>;
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
@@ -26,6 +42,18 @@ namespace rsl {
 	using StaticStack = Stack<T, DEFAULT_CAPACITY, StaticList<T, DEFAULT_CAPACITY>>;
 	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
 	using DynamicStack = Stack<T, DEFAULT_CAPACITY, DynamicList<T, DEFAULT_CAPACITY>>;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
+	using StaticFlatSet = FlatSet<T, DEFAULT_CAPACITY, StaticArray<T, DEFAULT_CAPACITY>>;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10>
+	using DynamicFlatSet = FlatSet<T, DEFAULT_CAPACITY, DynamicArray<T, DEFAULT_CAPACITY>>;
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY = 10>
+	using StaticFlatMap = FlatMap<K, V, DEFAULT_CAPACITY, StaticArray<FlatMapEntry<K, V>, DEFAULT_CAPACITY>>;
+	template<typename K, typename V, rsl::size_t DEFAULT_CAPACITY = 10>
+	using DynamicFlatMap = FlatMap<K, V, DEFAULT_CAPACITY, DynamicArray<FlatMapEntry<K, V>, DEFAULT_CAPACITY>>;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename COMPARE = std::less<T>, rsl::size_t ARITY = 2>
+	using StaticPriorityQueue = PriorityQueue<T, DEFAULT_CAPACITY, StaticArray<T, DEFAULT_CAPACITY>, COMPARE, ARITY>;
+	template<typename T, rsl::size_t DEFAULT_CAPACITY = 10, typename COMPARE = std::less<T>, rsl::size_t ARITY = 2>
+	using DynamicPriorityQueue = PriorityQueue<T, DEFAULT_CAPACITY, DynamicArray<T, DEFAULT_CAPACITY>, COMPARE, ARITY>;
 }
 
 #endif //RSL_TYPES_HPP
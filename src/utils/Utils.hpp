@@ -6,6 +6,8 @@
 #ifndef RSL_UTILS_HPP
 #define RSL_UTILS_HPP
 
+#include <Internal.hpp>
+
 
 namespace rsl {
 	template<typename T>
@@ -28,6 +30,188 @@ namespace rsl {
 		return (value < 0) ? -value : value;
 	}
 
+	/**
+	 * @usage round a value up to the next power of two
+	 * @param value
+	 * @return the smallest power of two that is not less than value, 1 if value is 0
+	 */
+	inline constexpr rsl::size_t nextPowerOfTwo(rsl::size_t value) {
+		rsl::size_t result = 1;
+		while (result < value)
+			result <<= 1;
+		return result;
+	}
+
+	/**
+	 * @usage build a new value in the place of a live object, lets containers that keep every slot constructed emplace
+	 * @param object
+	 * @param args arguments forwarded to the constructor of T
+	 */
+	template<typename T, typename... Args>
+	inline void reconstruct(T& object, Args&& ... args) {
+		object.~T();
+		new(&object) T(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @usage count the elements of [first, last), constant time for pointers
+	 * @param first
+	 * @param last
+	 * @return number of elements
+	 */
+	template<typename ITERATOR>
+	inline rsl::size_t distance(ITERATOR first, ITERATOR last) {
+		if constexpr (std::is_pointer<ITERATOR>::value) {
+			return static_cast<rsl::size_t>(last - first);
+		} else {
+			rsl::size_t count = 0;
+			for (; first != last; ++first)
+				++count;
+			return count;
+		}
+	}
+
+	/**
+	 * @usage move count live objects from source to destination, the ranges may overlap. trivially copyable types
+	 * are moved with a single memmove
+	 * @param destination
+	 * @param source
+	 * @param count
+	 */
+	template<typename T>
+	inline void moveRange(T* destination, T* source, rsl::size_t count) {
+		if (count == 0 || destination == source)
+			return;
+		if constexpr (std::is_trivially_copyable<T>::value) {
+			std::memmove(destination, source, sizeof(T) * count);
+		} else if (destination < source) {
+			for (rsl::size_t index = 0; index < count; ++index)
+				destination[index] = std::move(source[index]);
+		} else {
+			for (rsl::size_t index = count; index > 0; --index)
+				destination[index - 1] = std::move(source[index - 1]);
+		}
+	}
+
+	/**
+	 * @usage assign count elements read from first to the live objects at destination, a single memcpy if first is a
+	 * pointer to trivially copyable T
+	 * @param destination
+	 * @param first
+	 * @param count
+	 * @attention the ranges must not overlap
+	 */
+	template<typename T, typename ITERATOR>
+	inline void copyRange(T* destination, ITERATOR first, rsl::size_t count) {
+		if constexpr (std::is_pointer<ITERATOR>::value && std::is_trivially_copyable<T>::value &&
+		              std::is_same<typename std::remove_cv<typename std::remove_pointer<ITERATOR>::type>::type, T>::value) {
+			if (count != 0)
+				std::memcpy(destination, first, sizeof(T) * count);
+		} else {
+			for (rsl::size_t index = 0; index < count; ++index, ++first)
+				destination[index] = *first;
+		}
+	}
+
+	/**
+	 * @usage branchless binary search, the loop only does conditional moves so it does not pay for mispredicted branches
+	 * @param data sorted elements
+	 * @param length
+	 * @param key
+	 * @param less less(element, key), the order data is sorted by
+	 * @return index of the first element that is not less than key, length if there is none
+	 */
+	template<typename T, typename KEY, typename LESS>
+	inline rsl::size_t lowerBound(const T* data, rsl::size_t length, const KEY& key, LESS less) {
+		if (length == 0)
+			return 0;
+		const T* base = data;
+		while (length > 1) {
+			rsl::size_t half = length / 2;
+			base = less(base[half], key) ? base + half : base;
+			length -= half;
+		}
+		return static_cast<rsl::size_t>(base - data) + (less(*base, key) ? 1 : 0);
+	}
+
+	/**
+	 * @usage branchless binary search
+	 * @param data sorted elements
+	 * @param length
+	 * @param key
+	 * @param less less(key, element), the order data is sorted by
+	 * @return index of the first element that key is less than, length if there is none
+	 */
+	template<typename T, typename KEY, typename LESS>
+	inline rsl::size_t upperBound(const T* data, rsl::size_t length, const KEY& key, LESS less) {
+		if (length == 0)
+			return 0;
+		const T* base = data;
+		while (length > 1) {
+			rsl::size_t half = length / 2;
+			base = less(key, base[half]) ? base : base + half;
+			length -= half;
+		}
+		return static_cast<rsl::size_t>(base - data) + (less(key, *base) ? 0 : 1);
+	}
+
+	/**
+	 * @usage merge the sorted ranges [first, middle) and [middle, last) in place, without a temporary buffer.
+	 * stable, O(n log n) moves
+	 * @param first
+	 * @param middle
+	 * @param last
+	 * @param less less(a, b), the order both ranges are sorted by
+	 */
+	template<typename T, typename LESS>
+	inline void mergeInPlace(T* first, T* middle, T* last, LESS less) {
+		while (first != middle && middle != last) {
+			// elements already in place at both ends need no work
+			if (!less(*middle, *(middle - 1)))
+				return;
+			rsl::size_t leftLength = static_cast<rsl::size_t>(middle - first);
+			rsl::size_t rightLength = static_cast<rsl::size_t>(last - middle);
+			if (leftLength + rightLength == 2) {
+				std::swap(*first, *middle);
+				return;
+			}
+			T* leftCut;
+			T* rightCut;
+			if (leftLength > rightLength) {
+				leftCut = first + leftLength / 2;
+				rightCut = middle + lowerBound(middle, rightLength, *leftCut, less);
+			} else {
+				rightCut = middle + rightLength / 2;
+				leftCut = first + upperBound(first, leftLength, *rightCut, less);
+			}
+			T* newMiddle = std::rotate(leftCut, middle, rightCut);
+			// recurse into the smaller half, loop on the larger one to bound the stack depth
+			if (newMiddle - first < last - newMiddle) {
+				mergeInPlace(first, leftCut, newMiddle, less);
+				first = newMiddle;
+				middle = rightCut;
+			} else {
+				mergeInPlace(newMiddle, rightCut, last, less);
+				last = newMiddle;
+				middle = leftCut;
+			}
+		}
+	}
+
+	/**
+	 * @usage tells whether ALLOCATOR can resize a block in place through tryExpand(ptr, bytes)
+	 * @tparam ALLOCATOR
+	 */
+	template<typename ALLOCATOR, typename = void>
+	struct hasTryExpand {
+		static constexpr bool value = false;
+	};
+
+	template<typename ALLOCATOR>
+	struct hasTryExpand<ALLOCATOR, decltype(std::declval<ALLOCATOR&>().tryExpand(rsl::ptr_t{}, rsl::size_t{}), void())> {
+		static constexpr bool value = true;
+	};
+
 	template<typename T, typename U>
 	struct isSame {
 		static constexpr bool value = false;
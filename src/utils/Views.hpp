@@ -0,0 +1,586 @@
+//
+// Created by robcholz on 11/24/23.
+//
+#pragma once
+
+#ifndef RSL_VIEWS_HPP
+#define RSL_VIEWS_HPP
+
+#include <Internal.hpp>
+#include <utils/Utils.hpp>
+
+
+namespace rsl {
+	/**
+	 * @usage base of the lazy views, a view is cheap to copy and is stored by value inside the views built on it
+	 */
+	class RSL_UNUSED ViewBase {};
+
+	template<typename RANGE>
+	using RangeIterator = decltype(std::declval<const RANGE&>().begin());
+
+	/**
+	 * @usage view of a container that lives somewhere else, e.g. a StaticArray variable
+	 * @tparam RANGE container type, the container must outlive the view
+	 */
+	template<typename RANGE>
+	class RSL_UNUSED RefView : public ViewBase {
+	public:
+		explicit RefView(RANGE& range) : range(&range) {}
+
+		auto begin() const {
+			return range->begin();
+		}
+
+		auto end() const {
+			return range->end();
+		}
+
+	private:
+		RANGE* range;
+	};
+
+	/**
+	 * @usage view that owns a container passed as a temporary
+	 * @tparam RANGE container type
+	 */
+	template<typename RANGE>
+	class RSL_UNUSED OwningView : public ViewBase {
+	public:
+		explicit OwningView(RANGE&& range) : range(std::move(range)) {}
+
+		auto begin() const {
+			return range.begin();
+		}
+
+		auto end() const {
+			return range.end();
+		}
+
+	private:
+		// some containers only iterate through non-const begin(), the view itself stays read-only
+		mutable RANGE range;
+	};
+
+	/**
+	 * @usage elements of BASE passed through FUNC while iterating
+	 * @tparam BASE view
+	 * @tparam FUNC callable taking an element
+	 */
+	template<typename BASE, typename FUNC>
+	class RSL_UNUSED TransformView : public ViewBase {
+	public:
+		TransformView(BASE base, FUNC func);
+
+	private:
+		BASE base;
+		FUNC func;
+
+		class RSL_UNUSED Iterator {
+		private:
+			RangeIterator<BASE> current;
+			const FUNC* func;
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using reference = decltype((*func)(*current));
+			using value_type = typename std::remove_cv<typename std::remove_reference<reference>::type>::type;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+
+			Iterator(RangeIterator<BASE> current, const FUNC* func) : current(current), func(func) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return (*func)(*current);
+			}
+
+			Iterator& operator++() {
+				++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		Iterator begin() const;
+
+		Iterator end() const;
+	};
+
+	/**
+	 * @usage elements of BASE that satisfy PREDICATE
+	 * @tparam BASE view
+	 * @tparam PREDICATE callable taking an element and returning bool
+	 */
+	template<typename BASE, typename PREDICATE>
+	class RSL_UNUSED FilterView : public ViewBase {
+	public:
+		FilterView(BASE base, PREDICATE predicate);
+
+	private:
+		BASE base;
+		PREDICATE predicate;
+
+		class RSL_UNUSED Iterator {
+		private:
+			RangeIterator<BASE> current;
+			RangeIterator<BASE> last;
+			const PREDICATE* predicate;
+
+			void satisfy() {
+				while (current != last && !(*predicate)(*current))
+					++current;
+			}
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using reference = decltype(*current);
+			using value_type = typename std::remove_cv<typename std::remove_reference<reference>::type>::type;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+
+			Iterator(RangeIterator<BASE> current, RangeIterator<BASE> last, const PREDICATE* predicate)
+					: current(current), last(last), predicate(predicate) {
+				satisfy();
+			}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			Iterator& operator++() {
+				++current;
+				satisfy();
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		/**
+		 * @usage iterator func, walks to the first element that satisfies the predicate
+		 * @return begin
+		 */
+		Iterator begin() const;
+
+		Iterator end() const;
+	};
+
+	/**
+	 * @usage the first count elements of BASE, fewer if BASE is shorter
+	 * @tparam BASE view
+	 */
+	template<typename BASE>
+	class RSL_UNUSED TakeView : public ViewBase {
+	public:
+		TakeView(BASE base, rsl::size_t count);
+
+	private:
+		BASE base;
+		rsl::size_t count;
+
+		class RSL_UNUSED Iterator {
+		private:
+			RangeIterator<BASE> current;
+			rsl::size_t remaining;
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using reference = decltype(*current);
+			using value_type = typename std::remove_cv<typename std::remove_reference<reference>::type>::type;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+
+			Iterator(RangeIterator<BASE> current, rsl::size_t remaining) : current(current), remaining(remaining) {}
+
+			bool operator==(const Iterator& other) const {
+				// the end is reached after count elements or at the end of the base, whichever comes first
+				return remaining == other.remaining || current == other.current;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			Iterator& operator++() {
+				++current;
+				--remaining;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		Iterator begin() const;
+
+		Iterator end() const;
+	};
+
+	/**
+	 * @usage the elements of BASE after the first count, e.g. drop(length - n) for the last n samples
+	 * @tparam BASE view
+	 */
+	template<typename BASE>
+	class RSL_UNUSED DropView : public ViewBase {
+	public:
+		DropView(BASE base, rsl::size_t count);
+
+		/**
+		 * @usage iterator func, steps over the dropped elements
+		 * @return begin
+		 */
+		RangeIterator<BASE> begin() const;
+
+		RangeIterator<BASE> end() const;
+
+	private:
+		BASE base;
+		rsl::size_t count;
+	};
+
+	/**
+	 * @usage every step-th element of BASE, starting with the first, e.g. one channel of interleaved samples
+	 * @tparam BASE view
+	 */
+	template<typename BASE>
+	class RSL_UNUSED StrideView : public ViewBase {
+	public:
+		StrideView(BASE base, rsl::size_t step);
+
+	private:
+		BASE base;
+		rsl::size_t step;
+
+		class RSL_UNUSED Iterator {
+		private:
+			RangeIterator<BASE> current;
+			RangeIterator<BASE> last;
+			rsl::size_t step;
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using reference = decltype(*current);
+			using value_type = typename std::remove_cv<typename std::remove_reference<reference>::type>::type;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+
+			Iterator(RangeIterator<BASE> current, RangeIterator<BASE> last, rsl::size_t step)
+					: current(current), last(last), step(step) {}
+
+			bool operator==(const Iterator& other) const {
+				return current == other.current;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return *current;
+			}
+
+			Iterator& operator++() {
+				for (rsl::size_t i = 0; i < step && current != last; ++i)
+					++current;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		Iterator begin() const;
+
+		Iterator end() const;
+	};
+
+	/**
+	 * @usage pairs of elements of FIRST and SECOND at the same position, as long as the shorter one
+	 * @tparam FIRST view
+	 * @tparam SECOND view
+	 */
+	template<typename FIRST, typename SECOND>
+	class RSL_UNUSED ZipView : public ViewBase {
+	public:
+		ZipView(FIRST first, SECOND second);
+
+	private:
+		FIRST first;
+		SECOND second;
+
+		class RSL_UNUSED Iterator {
+		private:
+			RangeIterator<FIRST> firstCurrent;
+			RangeIterator<SECOND> secondCurrent;
+
+		public:
+			using iterator_category RSL_UNUSED = std::forward_iterator_tag;
+			using reference = std::pair<decltype(*firstCurrent), decltype(*secondCurrent)>;
+			using value_type = reference;
+			using difference_type RSL_UNUSED = std::ptrdiff_t;
+
+			Iterator(RangeIterator<FIRST> firstCurrent, RangeIterator<SECOND> secondCurrent)
+					: firstCurrent(firstCurrent), secondCurrent(secondCurrent) {}
+
+			bool operator==(const Iterator& other) const {
+				// either side reaching its end ends the zip
+				return firstCurrent == other.firstCurrent || secondCurrent == other.secondCurrent;
+			}
+
+			bool operator!=(const Iterator& other) const {
+				return !(*this == other);
+			}
+
+			reference operator*() const {
+				return reference(*firstCurrent, *secondCurrent);
+			}
+
+			Iterator& operator++() {
+				++firstCurrent;
+				++secondCurrent;
+				return *this;
+			}
+
+			Iterator operator++(int) {
+				Iterator temp = *this;
+				++(*this);
+				return temp;
+			}
+		};
+
+	public:
+		Iterator begin() const;
+
+		Iterator end() const;
+	};
+
+	template<typename BASE, typename FUNC>
+	TransformView<BASE, FUNC>::TransformView(BASE base, FUNC func) : base(std::move(base)), func(std::move(func)) {}
+
+	template<typename BASE, typename FUNC>
+	typename TransformView<BASE, FUNC>::Iterator TransformView<BASE, FUNC>::begin() const {
+		return Iterator(base.begin(), &func);
+	}
+
+	template<typename BASE, typename FUNC>
+	typename TransformView<BASE, FUNC>::Iterator TransformView<BASE, FUNC>::end() const {
+		return Iterator(base.end(), &func);
+	}
+
+	template<typename BASE, typename PREDICATE>
+	FilterView<BASE, PREDICATE>::FilterView(BASE base, PREDICATE predicate) : base(std::move(base)), predicate(std::move(predicate)) {}
+
+	template<typename BASE, typename PREDICATE>
+	typename FilterView<BASE, PREDICATE>::Iterator FilterView<BASE, PREDICATE>::begin() const {
+		return Iterator(base.begin(), base.end(), &predicate);
+	}
+
+	template<typename BASE, typename PREDICATE>
+	typename FilterView<BASE, PREDICATE>::Iterator FilterView<BASE, PREDICATE>::end() const {
+		return Iterator(base.end(), base.end(), &predicate);
+	}
+
+	template<typename BASE>
+	TakeView<BASE>::TakeView(BASE base, rsl::size_t count) : base(std::move(base)), count(count) {}
+
+	template<typename BASE>
+	typename TakeView<BASE>::Iterator TakeView<BASE>::begin() const {
+		return Iterator(base.begin(), count);
+	}
+
+	template<typename BASE>
+	typename TakeView<BASE>::Iterator TakeView<BASE>::end() const {
+		return Iterator(base.end(), 0);
+	}
+
+	template<typename BASE>
+	DropView<BASE>::DropView(BASE base, rsl::size_t count) : base(std::move(base)), count(count) {}
+
+	template<typename BASE>
+	RangeIterator<BASE> DropView<BASE>::begin() const {
+		auto current = base.begin();
+		auto last = base.end();
+		for (rsl::size_t i = 0; i < count && current != last; ++i)
+			++current;
+		return current;
+	}
+
+	template<typename BASE>
+	RangeIterator<BASE> DropView<BASE>::end() const {
+		return base.end();
+	}
+
+	template<typename BASE>
+	StrideView<BASE>::StrideView(BASE base, rsl::size_t step) : base(std::move(base)), step(step) {
+		RSL_RUNTIME_BOUND_CHECK_ARG(step == 0, "Stride must be larger than 0", this->step = 1;);
+	}
+
+	template<typename BASE>
+	typename StrideView<BASE>::Iterator StrideView<BASE>::begin() const {
+		return Iterator(base.begin(), base.end(), step);
+	}
+
+	template<typename BASE>
+	typename StrideView<BASE>::Iterator StrideView<BASE>::end() const {
+		return Iterator(base.end(), base.end(), step);
+	}
+
+	template<typename FIRST, typename SECOND>
+	ZipView<FIRST, SECOND>::ZipView(FIRST first, SECOND second) : first(std::move(first)), second(std::move(second)) {}
+
+	template<typename FIRST, typename SECOND>
+	typename ZipView<FIRST, SECOND>::Iterator ZipView<FIRST, SECOND>::begin() const {
+		return Iterator(first.begin(), second.begin());
+	}
+
+	template<typename FIRST, typename SECOND>
+	typename ZipView<FIRST, SECOND>::Iterator ZipView<FIRST, SECOND>::end() const {
+		return Iterator(first.end(), second.end());
+	}
+
+	/**
+	 * @usage lazy adaptors over anything with begin() and end(). nothing is evaluated or allocated until the result is
+	 * iterated, so a chain like
+	 *     for (float value: samples | views::filter(valid) | views::transform(scale) | views::take(16))
+	 * is a single pass over samples
+	 */
+	namespace views {
+		/**
+		 * @usage the argument of operator|, holds an adaptor waiting for its range
+		 */
+		template<typename ADAPT>
+		class RSL_UNUSED ViewAdaptor {
+		public:
+			explicit ViewAdaptor(ADAPT adapt) : adapt(std::move(adapt)) {}
+
+			template<typename RANGE>
+			auto operator()(RANGE&& range) const {
+				return adapt(std::forward<RANGE>(range));
+			}
+
+		private:
+			ADAPT adapt;
+		};
+
+		template<typename RANGE, typename ADAPT>
+		auto operator|(RANGE&& range, const ViewAdaptor<ADAPT>& adaptor) {
+			return adaptor(std::forward<RANGE>(range));
+		}
+
+		/**
+		 * @usage turn a range into a view: views are copied, other lvalues are referenced and temporaries are owned
+		 * @param range
+		 * @return the view
+		 */
+		template<typename RANGE>
+		auto all(RANGE&& range) {
+			using R = typename std::remove_reference<RANGE>::type;
+			if constexpr (std::is_base_of<ViewBase, R>::value)
+				return typename std::decay<RANGE>::type(std::forward<RANGE>(range));
+			else if constexpr (std::is_lvalue_reference<RANGE>::value)
+				return RefView<R>(range);
+			else
+				return OwningView<R>(std::move(range));
+		}
+
+		template<typename RANGE>
+		using AllView = decltype(all(std::declval<RANGE>()));
+
+		template<typename RANGE, typename FUNC>
+		auto transform(RANGE&& range, FUNC func) {
+			return TransformView<AllView<RANGE>, FUNC>(all(std::forward<RANGE>(range)), std::move(func));
+		}
+
+		template<typename FUNC>
+		auto transform(FUNC func) {
+			return ViewAdaptor([func](auto&& range) { return transform(std::forward<decltype(range)>(range), func); });
+		}
+
+		template<typename RANGE, typename PREDICATE>
+		auto filter(RANGE&& range, PREDICATE predicate) {
+			return FilterView<AllView<RANGE>, PREDICATE>(all(std::forward<RANGE>(range)), std::move(predicate));
+		}
+
+		template<typename PREDICATE>
+		auto filter(PREDICATE predicate) {
+			return ViewAdaptor([predicate](auto&& range) { return filter(std::forward<decltype(range)>(range), predicate); });
+		}
+
+		template<typename RANGE>
+		auto take(RANGE&& range, rsl::size_t count) {
+			return TakeView<AllView<RANGE>>(all(std::forward<RANGE>(range)), count);
+		}
+
+		inline auto take(rsl::size_t count) {
+			return ViewAdaptor([count](auto&& range) { return take(std::forward<decltype(range)>(range), count); });
+		}
+
+		template<typename RANGE>
+		auto drop(RANGE&& range, rsl::size_t count) {
+			return DropView<AllView<RANGE>>(all(std::forward<RANGE>(range)), count);
+		}
+
+		inline auto drop(rsl::size_t count) {
+			return ViewAdaptor([count](auto&& range) { return drop(std::forward<decltype(range)>(range), count); });
+		}
+
+		/**
+		 * @param range
+		 * @param step distance between two elements, 0 is treated as 1
+		 */
+		template<typename RANGE>
+		auto stride(RANGE&& range, rsl::size_t step) {
+			return StrideView<AllView<RANGE>>(all(std::forward<RANGE>(range)), step);
+		}
+
+		inline auto stride(rsl::size_t step) {
+			return ViewAdaptor([step](auto&& range) { return stride(std::forward<decltype(range)>(range), step); });
+		}
+
+		/**
+		 * @usage iterate two ranges side by side, e.g. two channels of a sensor
+		 * @return view of std::pair of the element references
+		 */
+		template<typename FIRST, typename SECOND>
+		auto zip(FIRST&& first, SECOND&& second) {
+			return ZipView<AllView<FIRST>, AllView<SECOND>>(all(std::forward<FIRST>(first)), all(std::forward<SECOND>(second)));
+		}
+	}
+}
+
+#endif //RSL_VIEWS_HPP
@@ -6,9 +6,219 @@
 #include <array>
 #include "catch2/catch_test_macros.hpp"
 #include "container/base/DynamicArray.hpp"
+#include "memory/MonotonicArena.hpp"
+#include "memory/ThreadCache.hpp"
+#include "utils/Types.hpp"
 
 
 TEST_CASE("Dynamic Array Test", "[dynamic_array]") {
 	using String = std::string;
 
-}
\ No newline at end of file
+	SECTION("Growth assertion") {
+		rsl::DynamicArray<int, 4> array_i4;
+		rsl::size_t reallocations = 0;
+		const int* previous = array_i4.getRowArray();
+		for (int i = 0; i < 10000; ++i) {
+			array_i4.addBack(i);
+			if (array_i4.getRowArray() != previous) {
+				previous = array_i4.getRowArray();
+				++reallocations;
+			}
+		}
+		CHECK(array_i4.length() == 10000);
+		CHECK(array_i4.capacity() < 2 * 10000);
+		CHECK(reallocations < 25); // geometric, not once per element
+		bool intact = true;
+		for (int i = 0; i < 10000; ++i)
+			intact = intact && array_i4.get(i) == i;
+		CHECK(intact);
+		array_i4.capacity(20000);
+		CHECK(array_i4.capacity() == 20000);
+		CHECK(array_i4.get(9999) == 9999);
+		array_i4.trimToSize();
+		CHECK(array_i4.capacity() == 10000);
+		CHECK(array_i4.get(9999) == 9999);
+		array_i4.empty();
+		array_i4.trimToSize();
+		CHECK(array_i4.capacity() == 0);
+		array_i4.addBack(7);
+		CHECK(array_i4.get(0) == 7);
+	}
+
+	SECTION("In place growth assertion") {
+		rsl::DynamicArray<char, 10, rsl::ByteAllocator<char, -1, rsl::ThreadCache>> array_c10;
+		const char* block = array_c10.getRowArray();
+		for (int i = 0; i < 16; ++i)
+			array_c10.addBack((char) ('a' + i));
+		CHECK(array_c10.getRowArray() == block); // still fits the size class of the block
+		CHECK(array_c10.get(15) == 'p');
+
+		rsl::DynamicArray<char, 10> plain_c10; // the default allocator cannot grow blocks in place
+		for (int i = 0; i < 16; ++i)
+			plain_c10.addBack((char) ('a' + i));
+		CHECK(plain_c10.get(15) == 'p');
+
+		rsl::StaticMonotonicArena<64> arena;
+		rsl::ArenaScope scope(arena);
+		rsl::DynamicArray<int, 4, rsl::ArenaAllocator<int>> array_i4;
+		const int* start = array_i4.getRowArray();
+		for (int i = 0; i < 1000; ++i)
+			array_i4.addBack(i);
+		CHECK(array_i4.get(999) == 999);
+		CHECK(arena.blocks() > 0);
+		const int* grown = array_i4.getRowArray();
+		CHECK(grown != start);
+		for (int i = 1000; i < 1500; ++i)
+			array_i4.addBack(i);
+		CHECK(array_i4.getRowArray() == grown); // latest allocation of the arena is bumped in place
+		CHECK(array_i4.get(1499) == 1499);
+	}
+
+	SECTION("Move and emplace assertion") {
+		rsl::DynamicArray<String, 2> array_str2;
+		for (int i = 0; i < 100; ++i)
+			array_str2.emplaceBack(40, (char) ('a' + i % 26)); // long enough to live on the heap
+		array_str2.emplaceFront("front");
+		array_str2.emplace(1, 3, 'x');
+		CHECK(array_str2.length() == 102);
+		CHECK(array_str2.get(0) == "front");
+		CHECK(array_str2.get(1) == "xxx");
+		CHECK(array_str2.get(101) == String(40, 'v'));
+
+		String moved(40, 'm');
+		const char* buffer = moved.data();
+		array_str2.addBack(std::move(moved));
+		CHECK(array_str2.get(102).data() == buffer);
+		array_str2.addBack(array_str2.get(0)); // may alias storage that is reallocated
+		CHECK(array_str2.get(103) == "front");
+
+		const String* storage = array_str2.getRowArray();
+		rsl::DynamicArray<String, 2> taken(std::move(array_str2));
+		CHECK(taken.getRowArray() == storage);
+		CHECK(taken.length() == 104);
+		CHECK(array_str2.length() == 0);
+
+		rsl::DynamicArray<String, 2> copied(taken);
+		CHECK(copied.length() == 104);
+		CHECK(copied.get(2) == taken.get(2));
+		copied = std::move(taken);
+		CHECK(copied.getRowArray() == storage);
+		CHECK(taken.length() == 0);
+		taken.addBack("reused");
+		CHECK(taken.get(0) == "reused");
+		CHECK(copied.remove(0) == "front");
+		CHECK(copied.get(0) == "xxx");
+	}
+
+	SECTION("insert() assertion") {
+		rsl::DynamicArray<int, 4> array_i4;
+		int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+		array_i4.insert(0, values, values + 4);
+		array_i4.insert(2, values + 4, values + 8);
+		array_i4.insert(8, values, values);
+		CHECK(array_i4.length() == 8);
+		int expected[] = {1, 2, 5, 6, 7, 8, 3, 4};
+		bool ordered = true;
+		for (int i = 0; i < 8; ++i)
+			ordered = ordered && array_i4.get(i) == expected[i];
+		CHECK(ordered);
+
+		array_i4.removeRange(1, 5); // 1 8 3 4
+		CHECK(array_i4.length() == 3);
+		CHECK(array_i4.get(1) == 3);
+		array_i4.appendBack(array_i4);
+		CHECK(array_i4.length() == 6);
+		CHECK(array_i4.get(5) == 4);
+		CHECK(array_i4.removeAll(rsl::DynamicArray<int, 4>(3)));
+		CHECK(array_i4.length() == 4);
+		CHECK(array_i4.get(1) == 4);
+
+		rsl::DynamicArray<String, 2> array_str2;
+		std::array<const char*, 3> words{"a", "b", "c"};
+		array_str2.insert(0, words.begin(), words.end());
+		array_str2.insert(1, words.begin(), words.end());
+		CHECK(array_str2.length() == 6);
+		CHECK(array_str2.get(0) == "a");
+		CHECK(array_str2.get(3) == "c");
+		CHECK(array_str2.get(5) == "c");
+		CHECK(array_str2.remove(1) == "a");
+		CHECK(array_str2.searchRemove("c"));
+		CHECK(array_str2.get(2) == "b");
+	}
+
+	SECTION("begin() end() assertion") {
+		rsl::DynamicArray<int, 4> array_i4;
+		CHECK(!(array_i4.begin() != array_i4.end()));
+		for (int i = 1; i <= 6; ++i)
+			array_i4.addBack(i);
+
+		int sum = 0;
+		rsl::size_t visited = 0;
+		for (int element: array_i4) {
+			sum += element;
+			++visited;
+		}
+		CHECK(visited == 6);
+		CHECK(sum == 21);
+		auto last = array_i4.end();
+		--last;
+		CHECK(*last == 6); // end() is one past the last element
+	}
+}
+
+namespace {
+	template<typename ARRAY>
+	bool storedInline(const ARRAY& array) {
+		auto* data = reinterpret_cast<const char*>(array.getRowArray());
+		auto* object = reinterpret_cast<const char*>(&array);
+		return data >= object && data < object + sizeof(ARRAY);
+	}
+}
+
+TEST_CASE("Small Array Test", "[small_array]") {
+	using String = std::string;
+
+	SECTION("Inline storage assertion") {
+		rsl::SmallArray<int, 4> array_i4;
+		CHECK(array_i4.capacity() == 4);
+		CHECK(storedInline(array_i4));
+		for (int i = 0; i < 4; ++i)
+			array_i4.addBack(i);
+		CHECK(storedInline(array_i4));
+		array_i4.addBack(4);
+		CHECK_FALSE(storedInline(array_i4));
+		CHECK(array_i4.capacity() > 4);
+		bool kept = true;
+		for (int i = 0; i < 5; ++i)
+			kept = kept && array_i4.get(i) == i;
+		CHECK(kept);
+		array_i4.removeRange(2, 4);
+		array_i4.trimToSize();
+		CHECK(array_i4.length() == 2);
+		CHECK(array_i4.get(1) == 1);
+	}
+
+	SECTION("Copy and move assertion") {
+		rsl::SmallArray<String, 2> small;
+		small.addBack("first");
+		small.emplaceBack(3, 's');
+		rsl::SmallArray<String, 2> copy(small);
+		CHECK(storedInline(copy));
+		CHECK(copy.get(1) == "sss");
+		rsl::SmallArray<String, 2> moved(std::move(small));
+		CHECK(small.isEmpty());
+		CHECK(storedInline(moved));
+		CHECK(moved.get(0) == "first");
+		moved.addBack("third");
+		CHECK_FALSE(storedInline(moved));
+		copy = std::move(moved);
+		CHECK(moved.isEmpty());
+		CHECK(copy.length() == 3);
+		CHECK(copy.get(2) == "third");
+		small = copy;
+		CHECK(small.length() == 3);
+		CHECK(small.get(0) == "first");
+		moved.addBack("again");
+		CHECK(moved.get(0) == "again");
+	}
+}
@@ -96,4 +96,52 @@ TEST_CASE("Dynamic List Test", "[dynamic_list]") {
 		}
 		std::cout << *it << std::endl;
 	}
-}
\ No newline at end of file
+
+	SECTION("Move and emplace assertion") {
+		list_str9.emplaceBack(3, 'b');
+		list_str9.emplaceFront("a");
+		String moved(40, 'c');
+		const char* buffer = moved.data();
+		list_str9.addBack(std::move(moved));
+		CHECK(list_str9.length() == 3);
+		CHECK(list_str9.front() == "a");
+		CHECK(list_str9.back().data() == buffer);
+
+		rsl::DynamicList<String, 9> taken(std::move(list_str9));
+		CHECK(taken.length() == 3);
+		CHECK(taken.back().data() == buffer);
+		CHECK(list_str9.isEmpty());
+		list_str9.addBack("reused");
+		CHECK(list_str9.front() == "reused");
+
+		rsl::DynamicList<String, 9> copied(taken);
+		CHECK(copied.length() == 3);
+		copied = std::move(list_str9);
+		CHECK(copied.length() == 1);
+		CHECK(copied.front() == "reused");
+		copied = taken;
+		CHECK(copied.length() == 3);
+		CHECK(copied.back() == String(40, 'c'));
+	}
+
+	SECTION("searchRemove() removeAll() duplicates assertion") {
+		list_i5.addBack(7);
+		list_i5.addBack(1);
+		list_i5.addBack(7);
+		list_i5.addBack(2);
+		list_i5.addBack(7);
+
+		CHECK(list_i5.searchRemove(7)); // the head element, only the first occurrence
+		CHECK(list_i5.length() == 4);
+		CHECK(list_i5.front() == 1);
+
+		rsl::DynamicList<int, 2> sevens;
+		sevens.addBack(7);
+		CHECK(list_i5.removeAll(sevens));
+		CHECK(list_i5.length() == 2);
+		CHECK(list_i5.front() == 1);
+		CHECK(list_i5.back() == 2);
+		CHECK(!list_i5.removeAll(sevens));
+		CHECK(!list_i5.searchRemove(7));
+	}
+}
@@ -0,0 +1,25 @@
+//
+// Created by robcholz on 11/23/23.
+//
+#pragma once
+
+#ifndef RSL_TEST_ELEMENTS_HPP
+#define RSL_TEST_ELEMENTS_HPP
+
+#include <vector>
+
+
+namespace rsl::test {
+	/**
+	 * @usage copy what a view yields front to back, so it can be compared with a std::vector in one CHECK
+	 */
+	template<typename VIEW>
+	std::vector<int> elements(const VIEW& view) {
+		std::vector<int> result;
+		for (int element: view)
+			result.push_back(element);
+		return result;
+	}
+}
+
+#endif //RSL_TEST_ELEMENTS_HPP
@@ -0,0 +1,175 @@
+//
+// Created by robcholz on 11/18/23.
+//
+
+#include <string>
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "utils/Types.hpp"
+
+
+TEST_CASE("Flat Set Test", "[flat_set]") {
+	SECTION("Sorted insert assertion") {
+		rsl::DynamicFlatSet<int> set;
+		CHECK(set.add(5));
+		CHECK(set.add(1));
+		CHECK(set.add(3));
+		CHECK_FALSE(set.add(3));
+		CHECK(set.length() == 3);
+		CHECK(set[0] == 1);
+		CHECK(set[1] == 3);
+		CHECK(set[2] == 5);
+		CHECK(set.contains(5));
+		CHECK_FALSE(set.contains(4));
+		CHECK(set.indexOf(3) == 1);
+		CHECK(set.indexOf(4) == -1);
+		CHECK(set.remove(3));
+		CHECK_FALSE(set.remove(3));
+		CHECK(set.length() == 2);
+		set.empty();
+		CHECK(set.isEmpty());
+	}
+
+	SECTION("Range query assertion") {
+		rsl::DynamicFlatSet<int> set;
+		int thresholds[] = {40, 10, 30, 20, 50};
+		CHECK(set.add(thresholds, thresholds + 5) == 5);
+		CHECK(set.lowerBound(0) == 0);
+		CHECK(set.lowerBound(20) == 1);
+		CHECK(set.lowerBound(25) == 2);
+		CHECK(set.upperBound(20) == 2);
+		CHECK(set.upperBound(50) == 5);
+		CHECK(set.lowerBound(60) == 5);
+		// elements in [15, 40]
+		CHECK(set.upperBound(40) - set.lowerBound(15) == 3);
+	}
+
+	SECTION("Batch insert assertion") {
+		rsl::DynamicFlatSet<int> set;
+		int first[] = {9, 1, 5, 1, 7};
+		CHECK(set.add(first, first + 5) == 4);
+		int second[] = {6, 9, 0, 6, 10};
+		CHECK(set.add(second, second + 5) == 3);
+		int expected[] = {0, 1, 5, 6, 7, 9, 10};
+		CHECK(set.length() == 7);
+		bool sorted = true;
+		for (rsl::size_t index = 0; index < set.length(); ++index)
+			sorted = sorted && set[index] == expected[index];
+		CHECK(sorted);
+	}
+
+	SECTION("Capacity assertion") {
+		rsl::StaticFlatSet<int, 4> set;
+		int batch[] = {8, 2, 6, 4, 0};
+		CHECK(set.add(batch, batch + 5) == 4);
+		CHECK(set.length() == 4);
+		CHECK(set[0] == 2);
+		CHECK(set[3] == 8);
+		CHECK_FALSE(set.add(5));
+		CHECK(set.remove(4));
+		CHECK(set.add(5));
+		CHECK(set[1] == 5);
+	}
+
+	SECTION("Merge assertion") {
+		rsl::DynamicFlatSet<int> set;
+		int existing[] = {30, 10, 20};
+		set.add(existing, existing + 3);
+		// in front of, between and behind the elements, with duplicates inside the batch and of the set
+		int batch[] = {35, 5, 20, 25, 5, 40, 15};
+		CHECK(set.add(batch, batch + 7) == 5);
+		int expected[] = {5, 10, 15, 20, 25, 30, 35, 40};
+		CHECK(set.length() == 8);
+		bool sorted = true;
+		for (rsl::size_t index = 0; index < set.length(); ++index)
+			sorted = sorted && set[index] == expected[index];
+		CHECK(sorted);
+		CHECK(set.remove(5));
+		CHECK(set.remove(40));
+		CHECK(set.add(0));
+		CHECK(set[0] == 0);
+		CHECK(set[6] == 35);
+	}
+}
+
+TEST_CASE("Flat Map Test", "[flat_map]") {
+	using String = std::string;
+
+	SECTION("Put and find assertion") {
+		rsl::DynamicFlatMap<int, float> map;
+		CHECK(map.find(3) == nullptr);
+		CHECK(map.put(3, 1.5f));
+		CHECK(map.put(7, 2.5f));
+		CHECK(map.put(3, 4.5f));
+		CHECK(map.length() == 2);
+		CHECK(*map.find(3) == 4.5f);
+		CHECK(map.get(7) == 2.5f);
+		CHECK(map.contains(7));
+		CHECK_FALSE(map.contains(8));
+		CHECK(map.remove(3));
+		CHECK_FALSE(map.remove(3));
+		CHECK(map.length() == 1);
+	}
+
+	SECTION("String key assertion") {
+		rsl::FlatMap<String, int> map; // the default DynamicArray base
+		CHECK(map.put("pressure", 2));
+		CHECK(map.put("humidity", 1));
+		CHECK(map.put(String(40, 't'), 3));
+		CHECK(map.find("altitude") == nullptr);
+		CHECK(map.get("humidity") == 1);
+		CHECK(map.entry(0).key == "humidity");
+		CHECK(map.entry(2).key == String(40, 't'));
+		CHECK(map.remove("pressure"));
+		CHECK(map.length() == 2);
+		rsl::StaticFlatMap<String, String, 4> names;
+		CHECK(names.put("b", String("beta")));
+		CHECK(names.put("a", String("alpha")));
+		CHECK(names.entry(0).value == "alpha");
+	}
+
+	SECTION("Calibration curve assertion") {
+		rsl::StaticFlatMap<int, double, 8> curve;
+		rsl::FlatMapEntry<int, double> points[] = {{1000, 10.0}, {0, 0.0}, {500, 4.0}, {250, 1.0}};
+		CHECK(curve.put(points, points + 4) == 4);
+		// interpolate between the two points around a raw reading
+		int raw = 750;
+		rsl::size_t upper = curve.lowerBound(raw);
+		const auto& high = curve.entry(upper);
+		const auto& low = curve.entry(upper - 1);
+		double value = low.value + (high.value - low.value) * (raw - low.key) / (high.key - low.key);
+		CHECK(value == 7.0);
+		CHECK(curve.upperBound(500) - curve.lowerBound(250) == 2);
+	}
+
+	SECTION("Batch put assertion") {
+		rsl::DynamicFlatMap<String, int> map;
+		map.put("b", 1);
+		std::vector<rsl::FlatMapEntry<String, int>> batch{{"d", 4}, {"b", 2}, {"a", 0}, {"c", 3}};
+		CHECK(map.put(batch.begin(), batch.end()) == 3);
+		CHECK(map.get("b") == 2);
+		String keys;
+		for (const auto& entry: map)
+			keys += entry.key;
+		CHECK(keys == "abcd");
+	}
+
+	SECTION("Batch overwrite assertion") {
+		rsl::StaticFlatMap<int, int, 8> map;
+		map.put(3, 30);
+		map.put(1, 10);
+		std::vector<rsl::FlatMapEntry<int, int>> batch{{3, 31}, {2, 20}, {0, 0}, {4, 40}};
+		CHECK(map.put(batch.begin(), batch.end()) == 3);
+		CHECK(map.length() == 5);
+		CHECK(map.get(3) == 31);
+		int keys = 0, values = 0;
+		for (const auto& entry: map) {
+			keys = keys * 10 + entry.key;
+			values += entry.value;
+		}
+		CHECK(keys == 1234); // 0 leads
+		CHECK(values == 0 + 10 + 20 + 31 + 40);
+		CHECK(map.remove(0));
+		CHECK(map.entry(0).key == 1);
+	}
+}
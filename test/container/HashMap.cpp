@@ -0,0 +1,245 @@
+//
+// Created by robcholz on 11/16/23.
+//
+
+#include <string>
+#include "catch2/catch_test_macros.hpp"
+#include "container/base/StaticHashMap.hpp"
+#include "container/base/DynamicHashMap.hpp"
+#include "memory/MonotonicArena.hpp"
+
+
+namespace {
+	// every key lands on the same home slot, so probe distances grow by one per key
+	struct CollidingHash {
+		rsl::size_t operator()(int) const { return 0; }
+	};
+
+	struct IdentityHash {
+		rsl::size_t operator()(int key) const { return static_cast<rsl::size_t>(key); }
+	};
+
+	// 10, 20, 30 sit at their home slots 1, 2, 3, 11 goes in front of 20 and shifts the run
+	struct TensHash {
+		rsl::size_t operator()(int key) const { return static_cast<rsl::size_t>(key / 10); }
+	};
+}
+
+TEST_CASE("Static Hash Map Test", "[static_hash_map]") {
+	using String = std::string;
+
+	SECTION("Put and find assertion") {
+		rsl::StaticHashMap<int, float, 8> map;
+		CHECK(map.capacity() == 8);
+		CHECK(map.isEmpty());
+		CHECK(map.find(3) == nullptr);
+		CHECK(map.put(3, 1.5f));
+		CHECK(map.put(7, 2.5f));
+		CHECK(map.put(3, 4.5f));
+		CHECK(map.length() == 2);
+		CHECK(*map.find(3) == 4.5f);
+		CHECK(map.get(7) == 2.5f);
+		CHECK(map.contains(7));
+		CHECK_FALSE(map.contains(8));
+		map[9] += 1.0f;
+		CHECK(map.get(9) == 1.0f);
+		CHECK(map.remove(3));
+		CHECK_FALSE(map.remove(3));
+		CHECK(map.length() == 2);
+		map.empty();
+		CHECK(map.isEmpty());
+		CHECK(map.find(7) == nullptr);
+	}
+
+	SECTION("Capacity assertion") {
+		rsl::StaticHashMap<int, int, 5> map;
+		for (int key = 0; key < 5; ++key)
+			CHECK(map.put(key * 100, key));
+		CHECK(map.isFull());
+		CHECK_FALSE(map.put(1000, 1));
+		CHECK_FALSE(map.emplace(1000, 1));
+		CHECK(map.put(200, 20));
+		CHECK(map.get(200) == 20);
+		CHECK(map.remove(0));
+		CHECK(map.put(1000, 1));
+	}
+
+	SECTION("Collision assertion") {
+		rsl::StaticHashMap<int, int, 8, CollidingHash> map;
+		for (int key = 0; key < 6; ++key)
+			CHECK(map.put(key, key * 10));
+		CHECK(map.remove(2)); // the rest of the run shifts back over it
+		CHECK_FALSE(map.contains(2));
+		CHECK(map.get(5) == 50);
+		CHECK(map.remove(0));
+		CHECK_FALSE(map.remove(0));
+		CHECK(map.put(2, 21));
+		CHECK(map.put(5, 51));
+		CHECK(map.length() == 5);
+		int sum = 0, visited = 0;
+		for (const auto& entry: map) {
+			sum += entry.value;
+			++visited;
+		}
+		CHECK(visited == 5);
+		CHECK(sum == 10 + 21 + 30 + 40 + 51);
+	}
+
+	SECTION("Aliasing assertion") {
+		rsl::StaticHashMap<int, String, 8, TensHash> map;
+		for (int key = 10; key <= 40; key += 10)
+			map.put(key, String(40, static_cast<char>('a' + key / 10)));
+		CHECK(map.put(11, map.get(20))); // the value is shifted by the insert
+		CHECK(map.emplace(12, map.get(30)));
+		CHECK(map.get(11) == String(40, 'c'));
+		CHECK(map.get(12) == String(40, 'd'));
+		CHECK(map.get(20) == String(40, 'c'));
+		CHECK(map.get(40) == String(40, 'e'));
+	}
+
+	SECTION("Non trivial value assertion") {
+		rsl::StaticHashMap<String, String, 16> map;
+		map.put("temperature", "celsius");
+		map.emplace("pressure", 3, 'p');
+		map["humidity"] = "percent";
+		CHECK(map.get("pressure") == "ppp");
+		CHECK(map.remove("temperature"));
+		rsl::StaticHashMap<String, String, 16> copy(map);
+		map.empty();
+		CHECK(copy.length() == 2);
+		CHECK(copy.get("humidity") == "percent");
+		map = copy;
+		CHECK(map.get("pressure") == "ppp");
+	}
+}
+
+TEST_CASE("Dynamic Hash Map Test", "[dynamic_hash_map]") {
+	using String = std::string;
+
+	SECTION("Growth assertion") {
+		rsl::DynamicHashMap<int, int, 4> map;
+		rsl::size_t initialCapacity = map.capacity();
+		CHECK(initialCapacity >= 4);
+		for (int key = 0; key < 1000; ++key)
+			CHECK(map.put(key * 7, key));
+		CHECK(map.length() == 1000);
+		CHECK(map.capacity() >= 1000);
+		bool found = true;
+		for (int key = 0; key < 1000; ++key)
+			found = found && map.get(key * 7) == key;
+		CHECK(found);
+		for (int key = 0; key < 990; ++key)
+			map.remove(key * 7);
+		map.trimToSize();
+		CHECK(map.capacity() < 64);
+		CHECK(map.get(995 * 7) == 995);
+		map.capacity(500);
+		CHECK(map.capacity() >= 500);
+		CHECK(map.length() == 10);
+	}
+
+	SECTION("Collision assertion") {
+		rsl::DynamicHashMap<int, int, 8, rsl::ByteAllocator<rsl::HashMapEntry<int, int>>, CollidingHash> map;
+		for (int key = 0; key < 100; ++key)
+			map.put(key, key); // one run, rehashed several times on the way
+		for (int key = 0; key < 100; key += 2)
+			CHECK(map.remove(key));
+		CHECK(map.length() == 50);
+		bool intact = true;
+		for (int key = 0; key < 100; ++key)
+			intact = intact && map.contains(key) == (key % 2 == 1) && (key % 2 == 0 || map.get(key) == key);
+		CHECK(intact);
+		CHECK(map.put(0, -1));
+		CHECK(map.get(0) == -1);
+		CHECK(map.get(99) == 99);
+		rsl::size_t visited = 0;
+		for (const auto& entry: map)
+			visited += entry.key == 0 || entry.value == entry.key;
+		CHECK(visited == 51);
+	}
+
+	SECTION("Probe overflow assertion") {
+		rsl::DynamicHashMap<int, String, 8, rsl::ByteAllocator<rsl::HashMapEntry<int, String>>, CollidingHash> map;
+		int added = 0;
+		while (added < 300 && map.put(added, String(20, static_cast<char>('a' + added % 26))))
+			++added;
+		// one home slot only fits MAX_PROBE - 1 keys, the failed rehash has to leave every value in place
+		CHECK(added == 254);
+		CHECK(map.length() == 254);
+		bool intact = true;
+		for (int key = 0; key < added; ++key)
+			intact = intact && map.get(key) == String(20, static_cast<char>('a' + key % 26));
+		CHECK(intact);
+	}
+
+	SECTION("Rehash rollback assertion") {
+		// multiples of 512 use two home slots in a table of 1024 but one in the table of 512 trimToSize picks
+		rsl::DynamicHashMap<int, String, 8, rsl::ByteAllocator<rsl::HashMapEntry<int, String>>, IdentityHash> map;
+		map.capacity(600);
+		for (int i = 0; i < 260; ++i)
+			map.put(i * 512, String(20, static_cast<char>('a' + i % 26)));
+		rsl::size_t capacity = map.capacity();
+		map.trimToSize();
+		CHECK(map.capacity() == capacity);
+		CHECK(map.length() == 260);
+		bool intact = true;
+		for (int i = 0; i < 260; ++i)
+			intact = intact && map.get(i * 512) == String(20, static_cast<char>('a' + i % 26));
+		CHECK(intact);
+	}
+
+	SECTION("Aliasing assertion") {
+		rsl::DynamicHashMap<int, String, 4> values;
+		values.put(0, String(40, 'v'));
+		for (int key = 1; key < 200; ++key)
+			values.put(key, values.get(key - 1)); // shifted or freed by a rehash
+		bool intact = true;
+		for (int key = 0; key < 200; ++key)
+			intact = intact && values.get(key) == String(40, 'v');
+		CHECK(intact);
+
+		// every value is the key of the next put
+		rsl::DynamicHashMap<String, String, 4> keys;
+		keys.put("key0", "key1");
+		for (int i = 1; i < 200; ++i)
+			keys.put(keys.get("key" + std::to_string(i - 1)), "key" + std::to_string(i + 1));
+		CHECK(keys.length() == 200);
+		bool chained = true;
+		for (int i = 0; i < 200; ++i)
+			chained = chained && keys.get("key" + std::to_string(i)) == "key" + std::to_string(i + 1);
+		CHECK(chained);
+	}
+
+	SECTION("Move and copy assertion") {
+		rsl::DynamicHashMap<String, int> map;
+		map.put("left", 1);
+		map.put("right", 2);
+		rsl::DynamicHashMap<String, int> copy(map);
+		rsl::DynamicHashMap<String, int> moved(std::move(map));
+		CHECK(map.isEmpty());
+		CHECK(map.find("left") == nullptr);
+		map.put("up", 3);
+		CHECK(map.get("up") == 3);
+		CHECK(moved.get("right") == 2);
+		copy.remove("left");
+		CHECK(moved.contains("left"));
+		moved = copy;
+		CHECK_FALSE(moved.contains("left"));
+		map = std::move(moved);
+		CHECK(map.length() == 1);
+		CHECK(map.get("right") == 2);
+	}
+
+	SECTION("Allocator policy assertion") {
+		rsl::MonotonicArena arena;
+		{
+			rsl::ArenaScope scope(arena);
+			rsl::DynamicHashMap<int, double, 4, rsl::ArenaAllocator<rsl::HashMapEntry<int, double>>> scoped;
+			for (int key = 0; key < 100; ++key)
+				scoped.put(key, key * 0.5);
+			CHECK(scoped.get(42) == 21.0);
+			CHECK(arena.size() > 0);
+		}
+		CHECK(arena.size() == 0);
+	}
+}
@@ -0,0 +1,120 @@
+//
+// Created by robcholz on 11/19/23.
+//
+
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "container/base/IntrusiveList.hpp"
+
+
+namespace {
+	struct ExpiryTag {};
+
+	struct Timer : rsl::IntrusiveListHook<>, rsl::IntrusiveListHook<ExpiryTag> {
+		int deadline{0};
+
+		Timer() = default;
+
+		explicit Timer(int deadline) : deadline(deadline) {}
+	};
+
+	template<typename LIST>
+	std::vector<int> deadlines(const LIST& list) {
+		std::vector<int> result;
+		for (const Timer& timer: list)
+			result.push_back(timer.deadline);
+		return result;
+	}
+}
+
+TEST_CASE("Intrusive List Test", "[intrusive_list]") {
+	Timer timers[6]{Timer(0), Timer(1), Timer(2), Timer(3), Timer(4), Timer(5)};
+	rsl::IntrusiveList<Timer> list;
+
+	SECTION("Add and pop assertion") {
+		CHECK(list.isEmpty());
+		list.addBack(timers[1]);
+		list.addBack(timers[2]);
+		list.addFront(timers[0]);
+		CHECK(list.length() == 3);
+		CHECK(list.front().deadline == 0);
+		CHECK(list.back().deadline == 2);
+		CHECK(deadlines(list) == std::vector<int>{0, 1, 2});
+		CHECK(timers[1].rsl::IntrusiveListHook<>::isLinked());
+		// a linked element is not added a second time
+		list.addBack(timers[1]);
+		CHECK(list.length() == 3);
+		list.popFront();
+		list.popBack();
+		CHECK(list.length() == 1);
+		CHECK(list.front().deadline == 1);
+		CHECK_FALSE(timers[0].rsl::IntrusiveListHook<>::isLinked());
+		list.popBack();
+		list.popBack();
+		CHECK(list.isEmpty());
+	}
+
+	SECTION("Remove and insert assertion") {
+		for (auto& timer: timers)
+			list.addBack(timer);
+		CHECK(list.remove(timers[3]));
+		CHECK_FALSE(list.remove(timers[3]));
+		CHECK_FALSE(list.contains(timers[3]));
+		CHECK(list.contains(timers[4]));
+		// keep the list ordered by deadline
+		auto position = list.begin();
+		while (position != list.end() && position->deadline < timers[3].deadline)
+			++position;
+		list.insert(position, timers[3]);
+		CHECK(deadlines(list) == std::vector<int>{0, 1, 2, 3, 4, 5});
+		auto last = list.end();
+		--last;
+		CHECK(last->deadline == 5);
+		list.empty();
+		CHECK(list.isEmpty());
+		CHECK_FALSE(timers[5].rsl::IntrusiveListHook<>::isLinked());
+	}
+
+	SECTION("Splice assertion") {
+		rsl::IntrusiveList<Timer> other;
+		list.addBack(timers[2]);
+		list.addBack(timers[3]);
+		other.addBack(timers[0]);
+		other.addBack(timers[1]);
+		list.appendFront(other);
+		CHECK(other.isEmpty());
+		other.addBack(timers[4]);
+		other.addBack(timers[5]);
+		list.appendBack(other);
+		CHECK(other.isEmpty());
+		CHECK(list.length() == 6);
+		CHECK(deadlines(list) == std::vector<int>{0, 1, 2, 3, 4, 5});
+		rsl::IntrusiveList<Timer> moved(std::move(list));
+		CHECK(list.isEmpty());
+		CHECK(moved.length() == 6);
+		CHECK(moved.back().deadline == 5);
+		list = std::move(moved);
+		CHECK(deadlines(list) == std::vector<int>{0, 1, 2, 3, 4, 5});
+		CHECK(moved.isEmpty());
+	}
+
+	SECTION("Multiple hook assertion") {
+		rsl::IntrusiveList<Timer, ExpiryTag> expired;
+		for (auto& timer: timers)
+			list.addBack(timer);
+		expired.addBack(timers[4]);
+		expired.addBack(timers[1]);
+		CHECK(deadlines(expired) == std::vector<int>{4, 1});
+		list.remove(timers[4]);
+		CHECK(expired.contains(timers[4]));
+		CHECK(list.length() == 5);
+		{
+			rsl::IntrusiveList<Timer, ExpiryTag> scoped;
+			scoped.appendBack(expired);
+		}
+		// the destructor unlinks, so the timers can be linked again
+		CHECK_FALSE(timers[1].rsl::IntrusiveListHook<ExpiryTag>::isLinked());
+		expired.addBack(timers[1]);
+		CHECK(expired.length() == 1);
+	}
+}
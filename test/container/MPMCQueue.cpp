@@ -0,0 +1,69 @@
+//
+// Created by robcholz on 11/11/23.
+//
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "catch2/catch_test_macros.hpp"
+#include "container/MPMCQueue.hpp"
+
+
+TEST_CASE("MPMC Queue Test", "[mpmc_queue]") {
+	rsl::MPMCQueue<int, 6> queue_i8;
+
+	SECTION("Capacity assertion") {
+		CHECK(queue_i8.capacity() == 8);
+		CHECK(queue_i8.isEmpty());
+	}
+
+	SECTION("tryAdd() tryPop() front() assertion") {
+		int element = -1;
+		CHECK_FALSE(queue_i8.front(element));
+		for (int i = 0; i < 8; ++i)
+			CHECK(queue_i8.tryAdd(i));
+		CHECK_FALSE(queue_i8.tryAdd(8));
+		CHECK(queue_i8.length() == 8);
+		CHECK(queue_i8.front(element));
+		CHECK(element == 0);
+		for (int i = 0; i < 8; ++i) {
+			CHECK(queue_i8.tryPop(element));
+			CHECK(element == i);
+		}
+		CHECK_FALSE(queue_i8.tryPop(element));
+		for (int i = 0; i < 20; ++i) {
+			queue_i8.add(i);
+			queue_i8.pop(element);
+			CHECK(element == i);
+		}
+		CHECK(queue_i8.isEmpty());
+	}
+
+	SECTION("Producers consumers assertion") {
+		constexpr int PRODUCERS = 4, CONSUMERS = 4, COUNT = 50000;
+		rsl::MPMCQueue<long, 64> queue;
+		std::atomic<long> sum{0};
+		std::atomic<int> popped{0};
+		std::vector<std::thread> threads;
+		for (int producer = 0; producer < PRODUCERS; ++producer) {
+			threads.emplace_back([&queue, producer]() {
+				for (long i = 0; i < COUNT; ++i)
+					queue.add(producer * COUNT + i);
+			});
+		}
+		for (int consumer = 0; consumer < CONSUMERS; ++consumer) {
+			threads.emplace_back([&queue, &sum, &popped]() {
+				long element;
+				while (popped.fetch_add(1) < PRODUCERS * COUNT) {
+					queue.pop(element);
+					sum += element;
+				}
+			});
+		}
+		for (auto& thread: threads)
+			thread.join();
+		long total = (long) PRODUCERS * COUNT;
+		CHECK(sum == total * (total - 1) / 2);
+		CHECK(queue.isEmpty());
+	}
+}
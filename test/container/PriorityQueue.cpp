@@ -0,0 +1,145 @@
+//
+// Created by robcholz on 11/22/23.
+//
+
+#include <string>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "catch2/catch_test_macros.hpp"
+#include "utils/Types.hpp"
+
+
+TEST_CASE("Priority Queue Test", "[priority_queue]") {
+	using String = std::string;
+
+	SECTION("Add and pop assertion") {
+		rsl::DynamicPriorityQueue<int> queue;
+		CHECK(queue.isEmpty());
+		queue.add(3);
+		queue.add(7);
+		queue.emplace(1);
+		queue.add(5);
+		CHECK(queue.length() == 4);
+		CHECK(queue.top() == 7);
+		queue.pop();
+		CHECK(queue.top() == 5);
+		queue.pop();
+		queue.pop();
+		CHECK(queue.top() == 1);
+		queue.pop();
+		CHECK(queue.isEmpty());
+		queue.pop();
+		CHECK(queue.isEmpty());
+		queue.add(2);
+		queue.empty();
+		CHECK(queue.isEmpty());
+	}
+
+	SECTION("Arity assertion") {
+		rsl::DynamicPriorityQueue<int, 10, std::less<int>, 4> quaternary;
+		rsl::DynamicPriorityQueue<int, 10, std::greater<int>, 3> minimum;
+		// enough elements for three levels of either heap, with duplicates
+		for (int i = 0; i < 40; ++i) {
+			quaternary.add(i * 7 % 20);
+			minimum.add(i * 7 % 20);
+		}
+		CHECK(quaternary.top() == 19);
+		CHECK(minimum.top() == 0);
+		quaternary.pop();
+		quaternary.pop();
+		minimum.pop();
+		minimum.pop();
+		CHECK(quaternary.top() == 18); // both 19 are gone
+		CHECK(minimum.top() == 1);
+		quaternary.replaceTop(-1);
+		minimum.replaceTop(30);
+		bool ordered = true;
+		int previous = quaternary.top();
+		for (quaternary.pop(); !quaternary.isEmpty(); quaternary.pop()) {
+			ordered = ordered && quaternary.top() <= previous;
+			previous = quaternary.top();
+		}
+		CHECK(previous == -1);
+		previous = minimum.top();
+		for (minimum.pop(); !minimum.isEmpty(); minimum.pop()) {
+			ordered = ordered && minimum.top() >= previous;
+			previous = minimum.top();
+		}
+		CHECK(previous == 30);
+		CHECK(ordered);
+	}
+
+	SECTION("Heapify assertion") {
+		std::vector<int> elements;
+		std::mt19937 random(4);
+		for (int i = 0; i < 1000; ++i)
+			elements.push_back(static_cast<int>(random() % 500));
+		rsl::DynamicPriorityQueue<int, 10, std::greater<int>, 4> queue(elements.begin(), elements.end());
+		CHECK(queue.length() == 1000);
+		// a short range is sifted up into the existing heap
+		int more[3]{-1, 800, -2};
+		queue.add(more, more + 3);
+		std::sort(elements.begin(), elements.end());
+		elements.insert(elements.begin(), {-2, -1});
+		elements.push_back(800);
+		for (int element: elements) {
+			CHECK(queue.top() == element);
+			queue.pop();
+		}
+		CHECK(queue.isEmpty());
+	}
+
+	SECTION("Static capacity assertion") {
+		rsl::StaticPriorityQueue<int, 8> queue;
+		CHECK(queue.capacity() == 8);
+		for (int i = 0; i < 10; ++i)
+			queue.add(i);
+		CHECK(queue.length() == 8);
+		CHECK(queue.top() == 7);
+		int range[5]{20, 30, 40, 50, 60};
+		queue.pop();
+		queue.pop();
+		queue.add(range, range + 5);
+		CHECK(queue.length() == 8);
+		CHECK(queue.top() == 30);
+	}
+
+	SECTION("Top k assertion") {
+		// keep the 5 smallest readings, the largest of them sits on top
+		rsl::StaticPriorityQueue<int, 5, std::less<int>, 4> smallest;
+		std::mt19937 random(5);
+		std::vector<int> readings;
+		for (int i = 0; i < 2000; ++i) {
+			int reading = static_cast<int>(random() % 100000);
+			readings.push_back(reading);
+			if (smallest.length() < 5)
+				smallest.add(reading);
+			else if (reading < smallest.top())
+				smallest.replaceTop(reading);
+		}
+		std::sort(readings.begin(), readings.end());
+		for (int i = 4; i >= 0; --i) {
+			CHECK(smallest.top() == readings[i]);
+			smallest.pop();
+		}
+	}
+
+	SECTION("Object assertion") {
+		rsl::DynamicPriorityQueue<String, 10, std::greater<String>> queue;
+		queue.add("pear");
+		queue.add(String("apple"));
+		queue.emplace(3, 'z');
+		queue.add("melon");
+		CHECK(queue.top() == "apple");
+		queue.replaceTop("orange");
+		CHECK(queue.top() == "melon");
+		queue.pop();
+		queue.pop();
+		queue.pop();
+		CHECK(queue.top() == "zzz");
+		queue.pop();
+		CHECK(queue.isEmpty());
+		CHECK(queue.top().empty());
+	}
+}
@@ -0,0 +1,60 @@
+//
+// Created by robcholz on 11/25/23.
+//
+
+#include <string>
+#include "catch2/catch_test_macros.hpp"
+#include "container/Queue.hpp"
+#include "memory/ObjectAllocator.hpp"
+
+
+TEST_CASE("Queue Test", "[queue]") {
+	using String = std::string;
+	using ListQueue = rsl::Queue<int, 10, rsl::DynamicList<int, 10, rsl::ObjectAllocator<rsl::DoublyListNode<int>>>>;
+
+	rsl::Queue<int> queue_i;
+	rsl::Queue<int> other_i;
+
+	SECTION("swap() assertion") {
+		queue_i.add(1);
+		queue_i.add(2);
+		queue_i.add(3);
+		other_i.add(10);
+		queue_i.swap(other_i);
+		CHECK(queue_i.length() == 1);
+		CHECK(queue_i.front() == 10);
+		CHECK(other_i.length() == 3);
+		other_i.pop(); // the oldest element leaves first
+		other_i.pop();
+		CHECK(other_i.length() == 1);
+		CHECK(other_i.front() == 3);
+
+		queue_i.swap(queue_i);
+		CHECK(queue_i.length() == 1);
+		CHECK(queue_i.front() == 10);
+	}
+
+	SECTION("swap() storage assertion") {
+		rsl::Queue<String> queue_str, other_str;
+		queue_str.add(String(40, 'a'));
+		const String* element = &queue_str.front();
+		queue_str.swap(other_str);
+		CHECK(queue_str.isEmpty());
+		CHECK(&other_str.front() == element); // same base container, the nodes are exchanged
+	}
+
+	SECTION("swap() different base container assertion") {
+		ListQueue other;
+		queue_i.add(1);
+		other.add(2);
+		other.add(3);
+		other.add(4);
+		queue_i.swap(other);
+		CHECK(queue_i.length() == 3);
+		CHECK(other.length() == 1);
+		CHECK(other.front() == 1);
+		queue_i.pop();
+		queue_i.pop();
+		CHECK(queue_i.front() == 4);
+	}
+}
@@ -0,0 +1,120 @@
+//
+// Created by robcholz on 11/14/23.
+//
+
+#include <thread>
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "container/base/StaticArray.hpp"
+#include "container/base/DynamicArray.hpp"
+#include "container/base/StaticList.hpp"
+#include "container/base/DynamicList.hpp"
+#include "container/Queue.hpp"
+#include "container/Stack.hpp"
+#include "stream/Pipeline.hpp"
+
+
+namespace {
+	constexpr int ROUNDS = 200;
+
+	// touches every method that used to keep scratch state in static locals, the result only depends on seed
+	long workload(int seed) {
+		long checksum = 0;
+		for (int round = 0; round < ROUNDS; ++round) {
+			const int base = seed * 100000 + round * 64;
+			rsl::StaticArray<int, 128> staticArray;
+			rsl::DynamicArray<int, 4> dynamicArray;
+			rsl::StaticList<int, 64> staticList;
+			rsl::DynamicList<int, 4> dynamicList;
+			for (int i = 0; i < 64; ++i) {
+				staticArray.addFront(base + i);
+				dynamicArray.add(i / 2, base + i);
+				staticList.addBack(base + i);
+				dynamicList.addFront(base + i);
+			}
+			staticArray.removeRange(10, 20);
+			dynamicArray.remove(5);
+			staticList.searchRemove(base + 7);
+			dynamicList.searchRemove(base);
+			dynamicList.popBack();
+
+			rsl::StaticArray<int, 256> arrayCopy(staticArray);
+			for (int element: arrayCopy)
+				checksum += element;
+			for (int element: dynamicArray)
+				checksum += element * 3;
+			for (int element: staticList)
+				checksum += element * 5;
+			for (int element: dynamicList)
+				checksum += element * 7;
+			checksum += arrayCopy.indexOf(base + 30) + dynamicArray.lastIndexOf(base + 1);
+			checksum += staticArray.contains(base + 15) ? 1 : 2;
+
+			rsl::Queue<int> queue, otherQueue;
+			rsl::Stack<int> stack, otherStack;
+			for (int i = 0; i < 8; ++i) {
+				queue.add(base + i);
+				stack.add(base - i);
+			}
+			otherQueue.add(seed);
+			otherStack.add(seed);
+			queue.swap(otherQueue);
+			stack.swap(otherStack);
+			checksum += static_cast<long>(queue.length() * 11 + otherQueue.length() + otherStack.length()) + stack.top();
+		}
+
+		rsl::Pipeline<int, float> kalman;
+		kalman.filter(rsl::Pipeline<int, float>::Filter::kalmanFilter);
+		for (int i = 0; i < 1000; ++i) {
+			kalman.add(seed + (i % 7) * 3);
+			kalman.update();
+		}
+		checksum += static_cast<long>(kalman.output() * 1000);
+		return checksum;
+	}
+}
+
+TEST_CASE("Reentrancy Test", "[reentrancy]") {
+	SECTION("Independent instances assertion") {
+		rsl::StaticArray<int, 4> first{1, 2};
+		rsl::StaticArray<int, 4> second{3, 4, 5};
+		rsl::StaticArray<int, 8> firstCopy(first);
+		rsl::StaticArray<int, 8> secondCopy(second);
+		CHECK(firstCopy.length() == 2);
+		CHECK(secondCopy.length() == 3);
+		CHECK(secondCopy[2] == 5);
+		CHECK_FALSE(firstCopy == secondCopy);
+
+		rsl::Queue<int> queue, otherQueue;
+		queue.add(1);
+		queue.add(2);
+		otherQueue.add(3);
+		queue.swap(otherQueue);
+		CHECK(queue.length() == 1);
+		CHECK(queue.front() == 3);
+		CHECK(otherQueue.length() == 2);
+
+		rsl::Stack<int> stack;
+		rsl::Stack<int, 10, rsl::DynamicList<int, 10, rsl::ObjectAllocator<rsl::DoublyListNode<int>>>> otherStack;
+		stack.add(1);
+		otherStack.add(2);
+		otherStack.add(3);
+		stack.swap(otherStack);
+		CHECK(stack.length() == 2);
+		CHECK(stack.top() == 3);
+		CHECK(otherStack.top() == 1);
+	}
+
+	SECTION("Threads assertion") {
+		const int threadCount = static_cast<int>(rsl::max(4u, rsl::min(16u, std::thread::hardware_concurrency())));
+		std::vector<long> expected(threadCount), results(threadCount);
+		for (int seed = 0; seed < threadCount; ++seed)
+			expected[seed] = workload(seed);
+		std::vector<std::thread> threads;
+		for (int seed = 0; seed < threadCount; ++seed)
+			threads.emplace_back([&results, seed]() { results[seed] = workload(seed); });
+		for (auto& thread: threads)
+			thread.join();
+		CHECK(results == expected);
+	}
+}
@@ -0,0 +1,237 @@
+//
+// Created by robcholz on 11/4/23.
+//
+
+#include <string>
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "container/base/StaticRingBuffer.hpp"
+#include "container/base/DynamicRingBuffer.hpp"
+#include "container/Deque.hpp"
+#include "utils/Types.hpp"
+
+
+namespace {
+	// non trivial elements through every rvalue, emplace and move path of a ring buffer backed deque
+	template<typename DEQUE>
+	void checkStringDeque() {
+		using String = std::string;
+		DEQUE deque;
+		String moved(40, 'b');
+		deque.addBack(std::move(moved));
+		deque.emplaceBack(3, 'x');
+		deque.emplaceFront(2, 'a');
+		deque.addFront(String(30, 'z'));
+		CHECK(deque.length() == 4);
+		deque.emplaceBack(1, 'y'); // full, ignored
+		CHECK(deque.length() == 4);
+		CHECK(deque.front() == String(30, 'z'));
+		CHECK(deque.get(1) == "aa");
+		CHECK(deque.get(2) == String(40, 'b'));
+		CHECK(deque.back() == "xxx");
+
+		DEQUE other(std::move(deque));
+		CHECK(other.length() == 4);
+		CHECK(other.back() == "xxx");
+		CHECK(deque.isEmpty());
+		deque.emplaceBack(5, 'q');
+		CHECK(deque.front() == "qqqqq");
+		deque = std::move(other);
+		CHECK(deque.length() == 4);
+		CHECK(deque.get(2) == String(40, 'b'));
+		CHECK(other.isEmpty());
+		deque.popFront();
+		deque.popFront();
+		deque.add(String(6, 'w'));
+		deque.emplaceBack(7, 'v'); // wraps around the end of the storage
+		CHECK(deque.length() == 4);
+		CHECK(deque.front() == String(40, 'b'));
+		CHECK(deque.back() == "vvvvvvv");
+	}
+}
+
+
+TEST_CASE("Static Ring Buffer Test", "[static_ring_buffer]") {
+	using String = std::string;
+
+	rsl::StaticRingBuffer<int, 5> ring_i5;
+	rsl::StaticRingBuffer<String, 4> ring_str4;
+
+	SECTION("Capacity assertion") {
+		CHECK(ring_i5.capacity() == 5);
+		CHECK(ring_str4.capacity() == 4);
+		CHECK(ring_i5.isEmpty());
+	}
+
+	SECTION("addBack() addFront() assertion") {
+		ring_i5.addBack(2);
+		ring_i5.addBack(3);
+		ring_i5.addFront(1);
+		ring_i5.addBack(4);
+		ring_i5.addFront(0);
+
+		CHECK(ring_i5.length() == 5);
+		CHECK(ring_i5.isFull());
+		ring_i5.addBack(5); // ignored, full
+		CHECK(ring_i5.length() == 5);
+
+		int index = 0;
+		for (const auto& element: ring_i5) {
+			CHECK(element == index);
+			++index;
+		}
+		CHECK(index == 5);
+		CHECK(ring_i5.front() == 0);
+		CHECK(ring_i5.back() == 4);
+		CHECK(ring_i5[2] == 2);
+	}
+
+	SECTION("popFront() popBack() wrap around assertion") {
+		for (int i = 0; i < 100; ++i) {
+			if (ring_i5.isFull())
+				ring_i5.popFront();
+			ring_i5.addBack(i);
+		}
+		CHECK(ring_i5.length() == 5);
+		CHECK(ring_i5.front() == 95);
+		CHECK(ring_i5.back() == 99);
+		ring_i5.popBack();
+		CHECK(ring_i5.back() == 98);
+
+		rsl::size_t firstLength, secondLength;
+		const int* first = ring_i5.firstSegment(firstLength);
+		const int* second = ring_i5.secondSegment(secondLength);
+		CHECK(firstLength + secondLength == 4);
+		int expected = 95;
+		for (rsl::size_t i = 0; i < firstLength; ++i, ++expected)
+			CHECK(first[i] == expected);
+		for (rsl::size_t i = 0; i < secondLength; ++i, ++expected)
+			CHECK(second[i] == expected);
+
+		auto it = ring_i5.end();
+		--it;
+		CHECK(*it == 98);
+		CHECK(ring_i5.end() - ring_i5.begin() == 4);
+	}
+
+	SECTION("String assertion") {
+		ring_str4.addBack("b");
+		ring_str4.addFront("a");
+		ring_str4.addBack("c");
+		CHECK(ring_str4.contains("c"));
+		ring_str4.popFront();
+		CHECK(ring_str4.front() == "b");
+		ring_str4.empty();
+		CHECK(ring_str4.isEmpty());
+	}
+}
+
+TEST_CASE("Dynamic Ring Buffer Test", "[dynamic_ring_buffer]") {
+	using String = std::string;
+
+	rsl::DynamicRingBuffer<int, 3> ring_i3;
+	rsl::DynamicRingBuffer<String, 3> ring_str3;
+
+	SECTION("Capacity assertion") {
+		CHECK(ring_i3.capacity() == 3);
+		ring_i3.capacity(10);
+		CHECK(ring_i3.capacity() == 10);
+	}
+
+	SECTION("capacity() keeps order assertion") {
+		ring_i3.addBack(9);
+		ring_i3.addBack(2);
+		ring_i3.popFront();
+		ring_i3.addBack(3);
+		ring_i3.addFront(1);
+		CHECK(ring_i3.isFull());
+
+		ring_i3.capacity(6);
+		ring_i3.addBack(4);
+		ring_i3.addBack(5);
+		ring_i3.addFront(0);
+		int index = 0;
+		for (const auto& element: ring_i3) {
+			CHECK(element == index);
+			++index;
+		}
+		CHECK(index == 6);
+
+		ring_i3.popBack();
+		ring_i3.popBack();
+		ring_i3.trimToSize();
+		CHECK(ring_i3.capacity() == 4);
+		CHECK(ring_i3.get(3) == 3);
+	}
+
+	SECTION("trimToSize() on empty assertion") {
+		ring_i3.trimToSize();
+		CHECK(ring_i3.capacity() == 1);
+		ring_i3.addBack(7);
+		CHECK(ring_i3.isFull());
+		CHECK(ring_i3.front() == 7);
+		ring_i3.addBack(8);
+		CHECK(ring_i3.length() == 1);
+		ring_i3.capacity(4);
+		ring_i3.addFront(6);
+		ring_i3.addBack(8);
+		CHECK(ring_i3.length() == 3);
+		CHECK(ring_i3.front() == 6);
+		CHECK(ring_i3.back() == 8);
+	}
+
+	SECTION("String assertion") {
+		ring_str3.addBack("x");
+		ring_str3.addBack("y");
+		rsl::DynamicRingBuffer<String, 3> copy(ring_str3);
+		copy.addFront("w");
+		CHECK(copy.length() == 3);
+		CHECK(copy.front() == "w");
+		CHECK(ring_str3.front() == "x");
+	}
+}
+
+TEST_CASE("Ring Buffer Deque Test", "[ring_deque]") {
+	rsl::Deque<int, 8, rsl::StaticRingBuffer<int, 8>> deque;
+
+	SECTION("Window assertion") {
+		for (int i = 0; i < 20; ++i) {
+			if (deque.length() == 8)
+				deque.pop();
+			deque.add(i);
+		}
+		CHECK(deque.length() == 8);
+		CHECK(deque.front() == 12);
+		CHECK(deque.back() == 19);
+		CHECK(deque.get(3) == 15);
+	}
+
+	SECTION("begin() end() assertion") {
+		rsl::Deque<int, 10, rsl::DynamicArray<int>> arrayDeque;
+		for (int i = 0; i < 12; ++i) {
+			if (deque.length() == 8)
+				deque.pop();
+			deque.add(i);
+			arrayDeque.add(i);
+		}
+		for (int& element: deque)
+			element *= 2;
+		for (int& element: arrayDeque)
+			element += 100;
+		std::vector<int> ring, array;
+		for (int element: deque)
+			ring.push_back(element);
+		for (int element: arrayDeque)
+			array.push_back(element);
+		CHECK(ring == std::vector<int>{8, 10, 12, 14, 16, 18, 20, 22}); // front to back, across the wrap
+		CHECK(array.size() == 12);
+		CHECK(array.front() == 100);
+		CHECK(array.back() == 111);
+		CHECK(arrayDeque.get(5) == 105);
+	}
+
+	SECTION("String move emplace assertion") {
+		checkStringDeque<rsl::StaticDeque<std::string, 4>>();
+		checkStringDeque<rsl::DynamicRingDeque<std::string, 4>>();
+	}
+}
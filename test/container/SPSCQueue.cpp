@@ -0,0 +1,80 @@
+//
+// Created by robcholz on 11/10/23.
+//
+
+#include <thread>
+#include "catch2/catch_test_macros.hpp"
+#include "container/SPSCQueue.hpp"
+
+
+TEST_CASE("SPSC Queue Test", "[spsc_queue]") {
+	rsl::SPSCQueue<int, 5> queue_i5;
+
+	SECTION("Capacity assertion") {
+		CHECK(queue_i5.capacity() == 5);
+		CHECK(queue_i5.isEmpty());
+	}
+
+	SECTION("push() pop() assertion") {
+		for (int i = 0; i < 5; ++i)
+			CHECK(queue_i5.push(i));
+		CHECK_FALSE(queue_i5.push(5));
+		CHECK(queue_i5.length() == 5);
+		int element = -1;
+		for (int i = 0; i < 5; ++i) {
+			CHECK(queue_i5.pop(element));
+			CHECK(element == i);
+		}
+		CHECK_FALSE(queue_i5.pop(element));
+		CHECK(queue_i5.isEmpty());
+	}
+
+	SECTION("pushN() popN() wrap around assertion") {
+		const int in[] = {0, 1, 2, 3, 4, 5, 6};
+		int out[7]{};
+		for (int round = 0; round < 10; ++round) {
+			CHECK(queue_i5.pushN(in, 3) == 3);
+			CHECK(queue_i5.popN(out, 7) == 3);
+			for (int i = 0; i < 3; ++i)
+				CHECK(out[i] == i);
+		}
+		CHECK(queue_i5.pushN(in, 7) == 5);
+		CHECK(queue_i5.popN(out, 2) == 2);
+		CHECK(out[1] == 1);
+		CHECK(queue_i5.pushN(in + 5, 2) == 2);
+		CHECK(queue_i5.popN(out, 7) == 5);
+		CHECK(out[0] == 2);
+		CHECK(out[4] == 6);
+	}
+
+	SECTION("Producer consumer assertion") {
+		constexpr long COUNT = 200000;
+		rsl::SPSCQueue<long, 64> queue;
+		std::thread producer([&queue]() {
+			long batch[16];
+			long next = 0;
+			while (next < COUNT) {
+				if (next % 3 == 0) {
+					if (queue.push(next))
+						++next;
+					continue;
+				}
+				rsl::size_t length = 0;
+				for (; length < 16 && next + (long) length < COUNT; ++length)
+					batch[length] = next + (long) length;
+				next += (long) queue.pushN(batch, length);
+			}
+		});
+		long expected = 0;
+		bool ordered = true;
+		long batch[8];
+		while (expected < COUNT) {
+			rsl::size_t length = queue.popN(batch, 8);
+			for (rsl::size_t i = 0; i < length; ++i, ++expected)
+				ordered = ordered && (batch[i] == expected);
+		}
+		producer.join();
+		CHECK(ordered);
+		CHECK(queue.isEmpty());
+	}
+}
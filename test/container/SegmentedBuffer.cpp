@@ -0,0 +1,173 @@
+//
+// Created by robcholz on 11/21/23.
+//
+
+#include <string>
+#include "catch2/catch_test_macros.hpp"
+#include "utils/Types.hpp"
+#include "memory/MonotonicArena.hpp"
+
+
+TEST_CASE("Segmented Buffer Test", "[segmented_buffer]") {
+	using String = std::string;
+
+	SECTION("Both ends assertion") {
+		rsl::SegmentedBuffer<int, 10, 4> buffer;
+		CHECK(buffer.isEmpty());
+		CHECK(buffer.capacity() == 0);
+		for (int i = 0; i < 10; ++i) {
+			buffer.addBack(i);
+			buffer.addFront(-i - 1);
+		}
+		CHECK(buffer.length() == 20);
+		CHECK(buffer.front() == -10);
+		CHECK(buffer.back() == 9);
+		CHECK(buffer.get(10) == 0);
+		CHECK(buffer[9] == -1);
+		CHECK(buffer.contains(-5));
+		CHECK_FALSE(buffer.contains(10));
+		auto last = buffer.end();
+		--last;
+		CHECK(*last == 9);
+		for (int i = 0; i < 9; ++i)
+			buffer.popFront();
+		CHECK(buffer.front() == -1);
+		for (int i = 0; i < 10; ++i)
+			buffer.popBack();
+		CHECK(buffer.length() == 1);
+		CHECK(buffer.front() == -1);
+		CHECK(buffer.capacity() == 4);
+		buffer.popBack();
+		CHECK(buffer.isEmpty());
+		CHECK(buffer.begin() == buffer.end());
+		buffer.trimToSize();
+		CHECK(buffer.capacity() == 0);
+	}
+
+	SECTION("Block capacity of one assertion") {
+		rsl::SegmentedBuffer<int, 10, 1> buffer;
+		buffer.addBack(1);
+		buffer.popBack();
+		buffer.addFront(2);
+		CHECK(buffer.capacity() == 1); // the empty block is reused
+		int visited = 0;
+		for (int element: buffer)
+			visited += element == 2;
+		CHECK(visited == 1);
+		CHECK(buffer.front() == 2);
+		CHECK(buffer.back() == 2);
+		buffer.popFront();
+		buffer.addBack(3);
+		buffer.addFront(4);
+		buffer.addFront(5);
+		CHECK(buffer.length() == 3);
+		CHECK(buffer.capacity() == 3);
+		CHECK(buffer.get(0) == 5);
+		CHECK(buffer.get(1) == 4);
+		CHECK(buffer.get(2) == 3);
+		buffer.empty();
+		buffer.addFront(6);
+		CHECK(buffer.capacity() == 1);
+		CHECK(*buffer.begin() == 6);
+		CHECK(++buffer.begin() == buffer.end());
+	}
+
+	SECTION("Reference stability assertion") {
+		rsl::SegmentedBuffer<int, 10, 8> buffer;
+		buffer.addBack(1);
+		buffer.addBack(2);
+		int* first = &buffer.front();
+		int* second = &buffer.back();
+		for (int i = 0; i < 5000; ++i) {
+			buffer.addFront(i);
+			buffer.addBack(i);
+		}
+		CHECK(first == &buffer.get(5000));
+		CHECK(second == &buffer.get(5001));
+		CHECK(*first == 1);
+		CHECK(*second == 2);
+		for (int i = 0; i < 4000; ++i)
+			buffer.popFront();
+		CHECK(*first == 1);
+	}
+
+	SECTION("Block boundary assertion") {
+		rsl::SegmentedBuffer<String, 10, 4> buffer;
+		// the first block is centred, so the fronts and backs cross into new blocks at different counts
+		for (int i = 0; i < 6; ++i) {
+			buffer.emplaceFront(20, static_cast<char>('f' - i));
+			buffer.addBack(String(20, static_cast<char>('g' + i)));
+		}
+		CHECK(buffer.length() == 12);
+		String order;
+		for (const String& element: buffer)
+			order += element[0];
+		CHECK(order == "abcdefghijkl");
+		for (int i = 0; i < 5; ++i) {
+			buffer.popFront();
+			buffer.popBack();
+		}
+		CHECK(buffer.front() == String(20, 'f'));
+		CHECK(buffer.back() == String(20, 'g'));
+		buffer.popBack();
+		CHECK(buffer.capacity() == 4); // emptied blocks are given back
+		buffer.popBack();
+		CHECK(buffer.isEmpty());
+		buffer.addFront("front");
+		buffer.addBack("back");
+		CHECK(buffer.get(0) == "front");
+		CHECK(buffer.get(1) == "back");
+	}
+
+	SECTION("Copy and move assertion") {
+		rsl::SegmentedBuffer<String, 10, 2> buffer("a", "b", "c");
+		buffer.addFront("z");
+		rsl::SegmentedBuffer<String, 10, 2> copy(buffer);
+		CHECK(copy == buffer);
+		copy.popFront();
+		CHECK_FALSE(copy == buffer);
+		rsl::SegmentedBuffer<String, 10, 2> moved(std::move(buffer));
+		CHECK(buffer.isEmpty());
+		CHECK(moved.front() == "z");
+		buffer.addBack("again");
+		CHECK(buffer.front() == "again");
+		moved = copy;
+		CHECK(moved.length() == 3);
+		CHECK(moved.front() == "a");
+		buffer = std::move(moved);
+		CHECK(buffer.back() == "c");
+		CHECK(moved.isEmpty());
+		buffer.empty();
+		CHECK(buffer.isEmpty());
+		buffer.addFront("x");
+		CHECK(buffer.back() == "x");
+	}
+
+	SECTION("Allocator policy assertion") {
+		rsl::MonotonicArena arena;
+		{
+			rsl::ArenaScope scope(arena);
+			rsl::SegmentedBuffer<int, 10, 16, rsl::ArenaAllocator<rsl::SegmentBlock<int, 16>>> buffer;
+			for (int i = 0; i < 100; ++i)
+				buffer.addBack(i);
+			CHECK(buffer.get(99) == 99);
+			CHECK(arena.size() >= 7 * sizeof(rsl::SegmentBlock<int, 16>));
+		}
+		CHECK(arena.size() == 0);
+	}
+
+	SECTION("Dynamic deque assertion") {
+		rsl::DynamicDeque<int> deque;
+		for (int i = 0; i < 1000; ++i)
+			deque.addFront(i);
+		CHECK(deque.length() == 1000);
+		CHECK(deque.front() == 999);
+		CHECK(deque.back() == 0);
+		deque.pop();
+		CHECK(deque.front() == 998);
+		long sum = 0;
+		for (int element: deque)
+			sum += element;
+		CHECK(sum == 998L * 999 / 2);
+	}
+}
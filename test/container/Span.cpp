@@ -0,0 +1,159 @@
+//
+// Created by robcholz on 11/23/23.
+//
+
+#include <string>
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "utils/Types.hpp"
+#include "Elements.hpp"
+
+
+namespace {
+	// takes any contiguous or ring storage, the way a subsystem receives a window of samples
+	long sum(rsl::RingSpan<const int> samples) {
+		long result = 0;
+		for (int sample: samples)
+			result += sample;
+		return result;
+	}
+}
+
+TEST_CASE("Span Test", "[span]") {
+	using String = std::string;
+	using rsl::test::elements;
+
+	SECTION("Span assertion") {
+		int array[6]{0, 1, 2, 3, 4, 5};
+		rsl::Span<int> span(array);
+		CHECK(span.length() == 6);
+		CHECK(span.front() == 0);
+		CHECK(span.back() == 5);
+		span[2] = 20;
+		CHECK(array[2] == 20);
+		rsl::Span<const int> view = span;
+		CHECK(view.get(2) == 20);
+		CHECK(view.get(6) == 0);
+		CHECK(elements(view.first(2)) == std::vector<int>{0, 1});
+		CHECK(elements(view.last(2)) == std::vector<int>{4, 5});
+		CHECK(elements(view.subSpan(1, 3)) == std::vector<int>{1, 20, 3});
+		CHECK(view.subSpan(4, 10).length() == 2);
+		CHECK(view.subSpan(7, 1).isEmpty());
+		CHECK(view.last(10).length() == 6);
+		CHECK(rsl::Span<int>().isEmpty());
+		CHECK(view.subSpan(7, 1).front() == 0);
+		CHECK(view.subSpan(7, 1).back() == 0);
+	}
+
+	SECTION("Array span assertion") {
+		rsl::StaticArray<int, 8> staticArray(1, 2, 3);
+		rsl::DynamicArray<int> dynamicArray;
+		for (int i = 0; i < 4; ++i)
+			dynamicArray.addBack(i * 10);
+		CHECK(staticArray.span().data() == staticArray.getRowArray());
+		CHECK(elements(dynamicArray.span()) == std::vector<int>{0, 10, 20, 30});
+		for (int& element: dynamicArray.span())
+			element += 1;
+		CHECK(dynamicArray.get(3) == 31);
+		const rsl::DynamicArray<int>& constArray = dynamicArray;
+		rsl::Span<const int> view = constArray.span();
+		CHECK(view.length() == 4);
+		CHECK(sum(staticArray.span()) == 6);
+		CHECK(sum(dynamicArray.span()) == 64);
+	}
+
+	SECTION("Ring span assertion") {
+		rsl::StaticRingBuffer<int, 8> ring;
+		CHECK(ring.span().isEmpty());
+		CHECK(ring.span().begin() == ring.span().end());
+		CHECK(ring.span().front() == 0);
+		CHECK(ring.span().back() == 0);
+		for (int i = 0; i < 6; ++i)
+			ring.addBack(i);
+		for (int i = 0; i < 4; ++i)
+			ring.popFront();
+		for (int i = 6; i < 12; ++i)
+			ring.addBack(i);
+		// full and wrapped, the view ends where it begins in storage
+		CHECK(ring.isFull());
+		rsl::RingSpan<int> span = ring.span();
+		CHECK(span.length() == 8);
+		CHECK(span.firstSpan().length() == 4);
+		CHECK(span.secondSpan().length() == 4);
+		CHECK(elements(span) == std::vector<int>{4, 5, 6, 7, 8, 9, 10, 11});
+		CHECK(span[5] == 9);
+		CHECK(span.get(8) == 0);
+		CHECK(span.front() == 4);
+		CHECK(span.back() == 11);
+		span[0] = 40;
+		CHECK(ring.front() == 40);
+		CHECK(elements(span.first(6)) == std::vector<int>{40, 5, 6, 7, 8, 9});
+		CHECK(elements(span.first(3)) == std::vector<int>{40, 5, 6});
+		CHECK(elements(span.last(6)) == std::vector<int>{6, 7, 8, 9, 10, 11});
+		CHECK(elements(span.last(2)) == std::vector<int>{10, 11});
+		CHECK(span.last(2).secondSpan().isEmpty());
+		int copy[8];
+		span.copyTo(copy);
+		CHECK(copy[7] == 11);
+		CHECK(sum(ring.span()) == 96);
+
+		rsl::DynamicRingBuffer<String, 4> strings;
+		strings.addBack("b");
+		strings.addBack("c");
+		strings.addFront("a");
+		const rsl::DynamicRingBuffer<String, 4>& constStrings = strings;
+		rsl::RingSpan<const String> view = constStrings.span();
+		CHECK(view.length() == 3);
+		CHECK(view.front() == "a");
+		CHECK(view.back() == "c");
+	}
+
+	SECTION("Deque span assertion") {
+		rsl::StaticDeque<int, 8> ringDeque;
+		rsl::Deque<int, 10, rsl::DynamicArray<int>> arrayDeque;
+		for (int i = 0; i < 5; ++i) {
+			ringDeque.addFront(i);
+			arrayDeque.addBack(i);
+		}
+		CHECK(elements(ringDeque.span()) == std::vector<int>{4, 3, 2, 1, 0});
+		CHECK(elements(arrayDeque.span()) == std::vector<int>{0, 1, 2, 3, 4});
+		CHECK(sum(ringDeque.span()) == sum(arrayDeque.span()));
+	}
+
+	SECTION("Append assertion") {
+		rsl::StaticArray<int, 8> staticArray(1, 2);
+		rsl::SmallArray<int, 4> smallArray;
+		smallArray.addBack(3);
+		smallArray.addBack(4);
+		// different array types exchange elements through spans
+		staticArray.appendBack(smallArray.span());
+		CHECK(elements(staticArray.span()) == std::vector<int>{1, 2, 3, 4});
+		staticArray.appendBack(staticArray.span().first(3));
+		CHECK(elements(staticArray.span()) == std::vector<int>{1, 2, 3, 4, 1, 2, 3});
+		staticArray.appendBack(staticArray.span());
+		CHECK(staticArray.length() == 7);
+
+		rsl::DynamicArray<int, 2> dynamicArray;
+		dynamicArray.addBack(7);
+		dynamicArray.addBack(8);
+		// the array grows while it reads its own elements
+		dynamicArray.appendBack(dynamicArray.span());
+		dynamicArray.appendBack(dynamicArray.span().last(3));
+		CHECK(elements(dynamicArray.span()) == std::vector<int>{7, 8, 7, 8, 8, 7, 8});
+
+		rsl::StaticRingBuffer<int, 4> ring;
+		for (int i = 0; i < 6; ++i) {
+			if (ring.isFull())
+				ring.popFront();
+			ring.addBack(i);
+		}
+		dynamicArray.empty();
+		dynamicArray.appendBack(ring.span());
+		CHECK(elements(dynamicArray.span()) == std::vector<int>{2, 3, 4, 5});
+		rsl::StaticArray<int, 5> small(9, 9);
+		small.appendBack(ring.span());
+		CHECK(small.length() == 2);
+		small.appendBack(ring.span().last(3));
+		CHECK(elements(small.span()) == std::vector<int>{9, 9, 3, 4, 5});
+	}
+}
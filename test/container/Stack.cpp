@@ -0,0 +1,94 @@
+//
+// Created by robcholz on 11/25/23.
+//
+
+#include <string>
+#include "catch2/catch_test_macros.hpp"
+#include "container/Stack.hpp"
+#include "container/base/StaticList.hpp"
+#include "memory/ObjectAllocator.hpp"
+
+
+TEST_CASE("Stack Test", "[stack]") {
+	using String = std::string;
+	using ListStack = rsl::Stack<int, 10, rsl::DynamicList<int, 10, rsl::ObjectAllocator<rsl::DoublyListNode<int>>>>;
+
+	rsl::Stack<int> stack_i;
+	rsl::Stack<int> other_i;
+
+	SECTION("add() pop() top() assertion") {
+		for (int i = 1; i <= 5; ++i)
+			stack_i.add(i);
+		stack_i.emplace(6);
+		CHECK(stack_i.length() == 6);
+		int popped[6];
+		for (int& element: popped) {
+			element = stack_i.top();
+			stack_i.pop();
+		}
+		CHECK(stack_i.isEmpty());
+		const int expected[6] = {6, 5, 4, 3, 2, 1}; // last in, first out
+		bool ordered = true;
+		for (int i = 0; i < 6; ++i)
+			ordered = ordered && popped[i] == expected[i];
+		CHECK(ordered);
+
+		stack_i.add(1);
+		stack_i.add(2);
+		stack_i.pop();
+		stack_i.add(3);
+		CHECK(stack_i.top() == 3);
+		stack_i.pop();
+		CHECK(stack_i.top() == 1);
+	}
+
+	SECTION("Static base container assertion") {
+		rsl::Stack<String, 4, rsl::StaticList<String, 4>> stack_str4;
+		stack_str4.add("bottom");
+		stack_str4.add(String(40, 'm'));
+		stack_str4.emplace(3, 't');
+		CHECK(stack_str4.top() == "ttt");
+		stack_str4.pop();
+		CHECK(stack_str4.top() == String(40, 'm'));
+		stack_str4.pop();
+		CHECK(stack_str4.top() == "bottom");
+		CHECK(stack_str4.length() == 1);
+	}
+
+	SECTION("swap() assertion") {
+		stack_i.add(1);
+		stack_i.add(2);
+		stack_i.add(3);
+		other_i.add(10);
+		stack_i.swap(other_i);
+		CHECK(stack_i.length() == 1);
+		CHECK(stack_i.top() == 10);
+		CHECK(other_i.length() == 3);
+		CHECK(other_i.top() == 3);
+
+		stack_i.swap(stack_i);
+		CHECK(stack_i.length() == 1);
+		CHECK(stack_i.top() == 10);
+	}
+
+	SECTION("swap() storage assertion") {
+		rsl::Stack<String> stack_str, other_str;
+		stack_str.add(String(40, 'a'));
+		const String* element = &stack_str.top();
+		stack_str.swap(other_str);
+		CHECK(stack_str.isEmpty());
+		CHECK(&other_str.top() == element); // same base container, the nodes are exchanged
+	}
+
+	SECTION("swap() different base container assertion") {
+		ListStack other;
+		stack_i.add(1);
+		other.add(2);
+		other.add(3);
+		stack_i.swap(other);
+		CHECK(stack_i.length() == 2);
+		CHECK(stack_i.top() == 3);
+		CHECK(other.length() == 1);
+		CHECK(other.top() == 1);
+	}
+}
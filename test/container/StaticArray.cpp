@@ -231,6 +231,36 @@ TEST_CASE("Static Array Test", "[static_array]") {
 		CHECK(array_str9.lastIndexOf("1234") == 3);
 	}
 
+	SECTION("begin() end() assertion") {
+		CHECK(!(array_d10.begin() != array_d10.end()));
+		array_i100.addBack(3);
+		array_i100.addBack(1);
+		array_i100.addBack(4);
+
+		int sum = 0;
+		rsl::size_t visited = 0;
+		for (int element: array_i100) {
+			sum += element;
+			++visited;
+		}
+		CHECK(visited == 3);
+		CHECK(sum == 8);
+		auto last = array_i100.end();
+		--last;
+		CHECK(*last == 4); // end() is one past the last element
+	}
+
+	SECTION("add() past the length assertion") {
+		rsl::StaticArray<int, 10> array_i10;
+		array_i10.addBack(1);
+		array_i10.add(5, 7); // rejected, the index is past the length
+		array_i10.emplace(2, 7);
+		CHECK(array_i10.length() == 1);
+		array_i10.add(1, 7); // at the length is an append
+		CHECK(array_i10.length() == 2);
+		CHECK(array_i10[1] == 7);
+	}
+
 	SECTION("print() assertion") {
 		array_str9.empty();
 		array_str9.addBack("4");
@@ -241,4 +271,43 @@ TEST_CASE("Static Array Test", "[static_array]") {
 
 		array_str9.print();
 	}
+
+	SECTION("emplace() assertion") {
+		array_str9.emplaceBack(3, 'b');
+		array_str9.emplaceFront("a");
+		array_str9.emplace(1, "ab");
+		String moved = "c";
+		array_str9.addBack(std::move(moved));
+		array_str9.add(0, array_str9[3]); // refers to an element that is shifted
+		CHECK(array_str9.length() == 5);
+		CHECK(array_str9[0] == "c");
+		CHECK(array_str9[1] == "a");
+		CHECK(array_str9[2] == "ab");
+		CHECK(array_str9[3] == "bbb");
+		CHECK(array_str9[4] == "c");
+
+		rsl::StaticArray<String, 9> taken;
+		taken = std::move(array_str9);
+		CHECK(taken.length() == 5);
+		CHECK(taken[3] == "bbb");
+		CHECK(array_str9.isEmpty());
+	}
+
+	SECTION("insert() assertion") {
+		int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+		array_i100.insert(0, values, values + 4);
+		array_i100.insert(2, values + 4, values + 8);
+		CHECK(array_i100.length() == 8);
+		CHECK(array_i100[2] == 5);
+		CHECK(array_i100[6] == 3);
+		CHECK(array_i100[7] == 4);
+
+		rsl::StaticArray<int, 9> array_i9;
+		array_i9.insert(0, values, values + 8);
+		array_i9.insert(4, values, values + 2);
+		CHECK(array_i9.length() == 8); // would not fit, ignored
+		array_i9.insert(8, values, values + 1);
+		CHECK(array_i9.length() == 9);
+		CHECK(array_i9[8] == 1);
+	}
 }
@@ -100,6 +100,43 @@ TEST_CASE("Static List Test", "[static_list]") {
 		std::cout << *it << std::endl;
 	}
 
+	SECTION("emplace() assertion") {
+		list_str9.emplaceBack(3, 'b');
+		list_str9.emplaceFront("a");
+		String moved = "c";
+		list_str9.addBack(std::move(moved));
+		CHECK(list_str9.length() == 3);
+		CHECK(list_str9.front() == "a");
+		CHECK(list_str9.back() == "c");
+
+		rsl::StaticList<String, 9> taken;
+		taken = std::move(list_str9);
+		CHECK(taken.length() == 3);
+		CHECK(taken.front() == "a");
+		CHECK(list_str9.isEmpty());
+	}
+
+	SECTION("searchRemove() removeAll() duplicates assertion") {
+		list_i5.addBack(7);
+		list_i5.addBack(1);
+		list_i5.addBack(7);
+		list_i5.addBack(2);
+		list_i5.addBack(7);
+
+		CHECK(list_i5.searchRemove(7)); // the head element, only the first occurrence
+		CHECK(list_i5.length() == 4);
+		CHECK(list_i5.front() == 1);
+
+		rsl::StaticList<int, 2> sevens;
+		sevens.addBack(7);
+		CHECK(list_i5.removeAll(sevens));
+		CHECK(list_i5.length() == 2);
+		CHECK(list_i5.front() == 1);
+		CHECK(list_i5.back() == 2);
+		CHECK(!list_i5.removeAll(sevens));
+		CHECK(!list_i5.searchRemove(7));
+	}
+
 	/*
 	SECTION("Append(const Array&) assertion") {
 		rsl::StaticArray<int, 9> array;
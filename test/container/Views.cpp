@@ -0,0 +1,94 @@
+//
+// Created by robcholz on 11/24/23.
+//
+
+#include <string>
+#include <vector>
+#include "catch2/catch_test_macros.hpp"
+#include "utils/Types.hpp"
+#include "utils/Views.hpp"
+#include "Elements.hpp"
+
+
+TEST_CASE("Views Test", "[views]") {
+	using String = std::string;
+	using namespace rsl;
+	using rsl::test::elements;
+
+	SECTION("Single adaptor assertion") {
+		StaticArray<int, 16> array(1, 2, 3, 4, 5, 6, 7);
+		CHECK(elements(views::transform(array, [](int x) { return x * 10; })) == std::vector<int>{10, 20, 30, 40, 50, 60, 70});
+		CHECK(elements(views::filter(array, [](int x) { return x % 2 == 0; })) == std::vector<int>{2, 4, 6});
+		CHECK(elements(views::take(array, 3)) == std::vector<int>{1, 2, 3});
+		CHECK(elements(views::take(array, 10)).size() == 7);
+		CHECK(elements(views::take(array, 0)).empty());
+		CHECK(elements(views::drop(array, 5)) == std::vector<int>{6, 7});
+		CHECK(elements(views::drop(array, 10)).empty());
+		CHECK(elements(views::stride(array, 3)) == std::vector<int>{1, 4, 7});
+		CHECK(elements(views::stride(array, 0)).size() == 7);
+		CHECK(elements(views::filter(array, [](int x) { return x > 100; })).empty());
+	}
+
+	SECTION("Pipe assertion") {
+		DynamicArray<int> samples;
+		for (int i = -5; i < 20; ++i)
+			samples.addBack(i);
+		auto features = samples | views::filter([](int x) { return x >= 0; })
+		                | views::transform([](int x) { return x * x; })
+		                | views::drop(2)
+		                | views::stride(2)
+		                | views::take(4);
+		CHECK(elements(features) == std::vector<int>{4, 16, 36, 64});
+		// the view refers to the array, it sees later changes
+		samples.get(7) = 100;
+		CHECK(elements(features) == std::vector<int>{10000, 16, 36, 64});
+		// a view can be reused as the base of another one
+		auto larger = features | views::filter([](int x) { return x > 20; });
+		CHECK(elements(larger) == std::vector<int>{10000, 36, 64});
+	}
+
+	SECTION("Container assertion") {
+		DynamicList<int> list;
+		StaticRingBuffer<int, 8> ring;
+		DynamicDeque<int> deque;
+		for (int i = 0; i < 6; ++i) {
+			list.addBack(i);
+			ring.addFront(i);
+			deque.addBack(i * 2);
+		}
+		CHECK(elements(list | views::drop(4)) == std::vector<int>{4, 5});
+		CHECK(elements(ring | views::take(2)) == std::vector<int>{5, 4});
+		CHECK(elements(deque | views::stride(2)) == std::vector<int>{0, 4, 8});
+		CHECK(elements(ring.span() | views::filter([](int x) { return x < 2; })) == std::vector<int>{1, 0});
+		// a temporary container is owned by the view
+		auto owned = DynamicArray<int>() | views::transform([](int x) { return x; });
+		CHECK(elements(owned).empty());
+	}
+
+	SECTION("Write through assertion") {
+		StaticArray<int, 8> array(1, 2, 3, 4);
+		for (int& element: array | views::filter([](int x) { return x % 2 == 1; }))
+			element = 0;
+		CHECK(elements(array.span()) == std::vector<int>{0, 2, 0, 4});
+	}
+
+	SECTION("Zip assertion") {
+		StaticArray<int, 8> left(1, 2, 3, 4, 5);
+		DynamicArray<String> right;
+		right.addBack("a");
+		right.addBack("b");
+		right.addBack("c");
+		std::vector<String> zipped;
+		for (auto [number, name]: views::zip(left, right))
+			zipped.push_back(name + std::to_string(number));
+		CHECK(zipped == std::vector<String>{"a1", "b2", "c3"});
+		for (auto pair: views::zip(left, right | views::take(2)))
+			pair.second += "!";
+		CHECK(right.get(1) == "b!");
+		CHECK(right.get(2) == "c");
+		int dot = 0;
+		for (auto [x, y]: views::zip(left | views::take(3), left | views::drop(2)))
+			dot += x * y;
+		CHECK(dot == 1 * 3 + 2 * 4 + 3 * 5);
+	}
+}
@@ -0,0 +1,317 @@
+//
+// Created by robcholz on 11/12/23.
+//
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstring>
+#include "catch2/catch_test_macros.hpp"
+#include "memory/ByteAllocator.hpp"
+#include "memory/ObjectAllocator.hpp"
+#include "memory/HeapAllocator.hpp"
+#include "memory/SlabAllocator.hpp"
+#include "memory/ThreadCache.hpp"
+#include "memory/MonotonicArena.hpp"
+#include "container/base/DynamicArray.hpp"
+#include "container/base/DynamicList.hpp"
+
+
+TEST_CASE("Heap Allocator Test", "[heap_allocator]") {
+	rsl::HeapAllocator<double, 4> heap_d4;
+
+	SECTION("malloc() free() assertion") {
+		CHECK(heap_d4.maxObjects() == 4);
+		double* slots[4];
+		for (auto& slot: slots) {
+			slot = heap_d4.malloc();
+			REQUIRE(slot != nullptr);
+			*slot = 1.5;
+		}
+		CHECK(heap_d4.size() == 4);
+		CHECK(heap_d4.freeBytes() == 0);
+		CHECK(heap_d4.malloc() == nullptr);
+		CHECK(heap_d4.failures() == 1);
+		heap_d4.free(slots[2]);
+		CHECK(heap_d4.malloc() == slots[2]); // last freed slot is reused first
+		heap_d4.free(slots[0]);
+		heap_d4.free(slots[1]);
+		CHECK(heap_d4.size() == 2);
+		CHECK(heap_d4.highWaterMark() == 4);
+		CHECK(heap_d4.allocatedBytes() == 2 * sizeof(double));
+		CHECK(heap_d4.malloc(sizeof(double) + 1) == nullptr);
+		CHECK(heap_d4.failures() == 2);
+		CHECK(heap_d4.size() == 2);
+		CHECK(heap_d4.malloc(sizeof(float)) != nullptr);
+	}
+}
+
+TEST_CASE("Slab Allocator Test", "[slab_allocator]") {
+	rsl::SlabAllocator<std::string, 4> slab_str4;
+	rsl::SlabAllocator<int, 2, 2> slab_i2;
+
+	SECTION("Growth assertion") {
+		CHECK(slab_str4.chunks() == 0);
+		std::vector<std::string*> strings;
+		for (int i = 0; i < 10; ++i) {
+			auto* string = new(slab_str4.malloc()) std::string(50, (char) ('a' + i));
+			strings.push_back(string);
+		}
+		CHECK(slab_str4.chunks() == 3);
+		CHECK(slab_str4.size() == 10);
+		CHECK(slab_str4.maxObjects() == -1);
+		for (int i = 0; i < 10; ++i)
+			CHECK((*strings[i])[49] == (char) ('a' + i));
+		for (auto* string: strings) {
+			string->~basic_string();
+			slab_str4.free(string);
+		}
+		CHECK(slab_str4.size() == 0);
+		CHECK(slab_str4.highWaterMark() == 10);
+		slab_str4.malloc();
+		CHECK(slab_str4.chunks() == 3); // freed slots are reused
+	}
+
+	SECTION("Limit assertion") {
+		CHECK(slab_i2.maxObjects() == 4);
+		slab_i2.reserve(3);
+		CHECK(slab_i2.chunks() == 2);
+		int* slots[4];
+		for (auto& slot: slots)
+			slot = slab_i2.malloc();
+		CHECK(slab_i2.malloc() == nullptr);
+		CHECK(slab_i2.failures() == 1);
+		slab_i2.free(slots[1]);
+		CHECK(slab_i2.malloc() == slots[1]);
+	}
+
+	SECTION("DynamicList node pool assertion") {
+		rsl::DynamicList<std::string> list;
+		for (int round = 0; round < 100; ++round) {
+			list.addBack("x" + std::to_string(round));
+			list.addFront("y");
+			list.popFront();
+			if (round % 2 == 1)
+				list.popBack();
+		}
+		CHECK(list.length() == 50);
+		CHECK(list.front() == "x0");
+	}
+}
+
+TEST_CASE("Object Byte Allocator Test", "[object_byte_allocator]") {
+	SECTION("System heap accounting assertion") {
+		rsl::ObjectAllocator<long, 3> object_l3;
+		long* objects[3];
+		for (auto& object: objects)
+			object = object_l3.malloc();
+		CHECK(object_l3.malloc() == nullptr);
+		CHECK(object_l3.size() == 3);
+		for (auto* object: objects)
+			object_l3.free(object);
+		CHECK(object_l3.size() == 0);
+
+		rsl::ByteAllocator<char, 100> byte_100;
+		char* first = byte_100.malloc(60);
+		CHECK(byte_100.malloc(50) == nullptr);
+		char* second = byte_100.malloc(40);
+		CHECK(reinterpret_cast<rsl::size_t>(second) % alignof(std::max_align_t) == 0);
+		std::memset(second, 0xAB, 40);
+		CHECK(byte_100.size() == 100);
+		byte_100.free(first);
+		CHECK(byte_100.size() == 40);
+		CHECK_FALSE(byte_100.tryExpand(second, 50)); // block sizes are only kept for the limit
+		byte_100.free(second);
+		CHECK(byte_100.size() == 0);
+	}
+
+	SECTION("System heap unlimited assertion") {
+		rsl::ByteAllocator<char> byte;
+		char* block = byte.malloc(64);
+		REQUIRE(block != nullptr);
+		std::memset(block, 0xAB, 64);
+		CHECK(byte.size() == 0); // nothing to enforce, so no block sizes are kept
+		CHECK(byte.maxBytes() == -1);
+		CHECK_FALSE(byte.tryExpand(block, 32));
+		byte.free(block);
+		byte.free(nullptr);
+
+		rsl::DynamicArray<std::string> array;
+		rsl::DynamicList<std::string> list;
+		for (int i = 0; i < 100; ++i) {
+			array.addBack(std::string(40, (char) ('a' + i % 26)));
+			list.addBack(std::string(40, (char) ('a' + i % 26)));
+		}
+		CHECK(array.get(99) == std::string(40, 'v'));
+		CHECK(list.back() == std::string(40, 'v'));
+	}
+}
+
+TEST_CASE("Thread Cache Test", "[thread_cache]") {
+	SECTION("Size class assertion") {
+		void* small = rsl::ThreadCache::allocate(10);
+		void* large = rsl::ThreadCache::allocate(rsl::ThreadCache::MAX_BLOCK + 1);
+		CHECK(rsl::ThreadCache::requestedBytes(small) == 10);
+		CHECK(rsl::ThreadCache::requestedBytes(large) == rsl::ThreadCache::MAX_BLOCK + 1);
+		CHECK(reinterpret_cast<rsl::size_t>(small) % alignof(std::max_align_t) == 0);
+		std::memset(large, 0xAB, rsl::ThreadCache::MAX_BLOCK + 1);
+		rsl::ThreadCache::deallocate(small);
+		rsl::ThreadCache::deallocate(large);
+		CHECK(rsl::ThreadCache::allocate(16) == small); // same class, last freed block first
+		rsl::ThreadCache::deallocate(small);
+		rsl::ThreadCache::flush();
+		CHECK(rsl::ThreadCache::cachedBlocks() == 0);
+	}
+
+	SECTION("Destroyed cache assertion") {
+		static void* freed;
+		static rsl::size_t lateCached;
+		// constructed before the cache of its thread, so destroyed after it, like a static container at exit
+		struct Holder {
+			void* block{nullptr};
+
+			~Holder() {
+				rsl::ThreadCache::deallocate(block);
+				void* late = rsl::ThreadCache::allocate(3000);
+				std::memset(late, 0xAB, 3000);
+				rsl::ThreadCache::deallocate(late);
+				lateCached = rsl::ThreadCache::cachedBlocks();
+			}
+		};
+		lateCached = 1;
+		std::thread([] {
+			thread_local Holder holder;
+			holder.block = rsl::ThreadCache::allocate(3000);
+			freed = holder.block;
+		}).join();
+		void* reused = nullptr;
+		// a fresh thread refills from the depot, the block freed after the cache is on top
+		std::thread([&reused] {
+			reused = rsl::ThreadCache::allocate(3000);
+			rsl::ThreadCache::deallocate(reused);
+		}).join();
+		CHECK(reused == freed);
+		CHECK(lateCached == 0);
+	}
+
+	SECTION("ObjectAllocator ByteAllocator accounting assertion") {
+		rsl::ObjectAllocator<long, 3, rsl::ThreadCache> object_l3;
+		long* objects[3];
+		for (auto& object: objects)
+			object = object_l3.malloc();
+		CHECK(object_l3.malloc() == nullptr);
+		CHECK(object_l3.size() == 3);
+		for (auto* object: objects)
+			object_l3.free(object);
+		CHECK(object_l3.size() == 0);
+
+		rsl::ByteAllocator<char, 100, rsl::ThreadCache> byte_100;
+		char* first = byte_100.malloc(60);
+		CHECK(byte_100.malloc(50) == nullptr);
+		char* second = byte_100.malloc(40);
+		CHECK(byte_100.size() == 100);
+		byte_100.free(first);
+		CHECK(byte_100.size() == 40);
+		byte_100.free(second);
+		CHECK(byte_100.size() == 0);
+
+		rsl::ByteAllocator<char, -1, rsl::ThreadCache> byte;
+		char* block = byte.malloc(20);
+		CHECK(byte.size() == 20);
+		CHECK(byte.tryExpand(block, 30)); // same size class
+		CHECK(byte.size() == 30);
+		byte.free(block);
+		CHECK(byte.size() == 0);
+	}
+
+	SECTION("Threads assertion") {
+		constexpr int THREADS = 8, ROUNDS = 20, BLOCKS = 500;
+		rsl::ObjectAllocator<std::uint64_t, -1, rsl::ThreadCache> shared;
+		std::vector<std::uint64_t*> handedOver[THREADS];
+		std::vector<std::thread> threads;
+		bool intact[THREADS];
+		for (int thread = 0; thread < THREADS; ++thread) {
+			threads.emplace_back([&shared, &handedOver, &intact, thread]() {
+				intact[thread] = true;
+				std::vector<std::uint64_t*> blocks;
+				for (int round = 0; round < ROUNDS; ++round) {
+					for (int i = 0; i < BLOCKS; ++i) {
+						blocks.push_back(shared.malloc());
+						*blocks.back() = (std::uint64_t) thread << 32 | (std::uint64_t) i;
+					}
+					for (int i = 0; i < BLOCKS; ++i)
+						intact[thread] = intact[thread] && *blocks[i] == ((std::uint64_t) thread << 32 | (std::uint64_t) i);
+					for (int i = 0; i < BLOCKS; ++i) {
+						if (round == ROUNDS - 1 && i % 2 == 0)
+							handedOver[thread].push_back(blocks[i]); // freed by another thread
+						else
+							shared.free(blocks[i]);
+					}
+					blocks.clear();
+				}
+			});
+		}
+		for (auto& thread: threads)
+			thread.join();
+		for (auto& blocks: handedOver) {
+			for (auto* block: blocks)
+				shared.free(block);
+		}
+		for (bool threadIntact: intact)
+			CHECK(threadIntact);
+		CHECK(shared.size() == 0);
+	}
+}
+
+TEST_CASE("Monotonic Arena Test", "[monotonic_arena]") {
+	rsl::StaticMonotonicArena<256> arena(512);
+
+	SECTION("allocate() rewind() reset() assertion") {
+		auto* first = static_cast<unsigned char*>(arena.allocate(1, 1));
+		auto* second = static_cast<unsigned char*>(arena.allocate(8, 8));
+		CHECK(second - first == 8); // padded up to the alignment
+		CHECK(arena.size() == 16);
+		CHECK(arena.blocks() == 0);
+		rsl::MonotonicArena::Marker marker = arena.mark();
+		for (int i = 0; i < 100; ++i)
+			std::memset(arena.allocate(64), i, 64);
+		CHECK(arena.blocks() > 1);
+		CHECK(arena.size() >= 16 + 100 * 64);
+		arena.rewind(marker);
+		CHECK(arena.blocks() == 0);
+		CHECK(arena.size() == 16);
+		CHECK(arena.allocate(8, 8) == second + 8);
+		void* large = arena.allocate(1 << 16);
+		REQUIRE(large != nullptr);
+		CHECK(arena.blocks() == 1);
+		arena.reset();
+		CHECK(arena.blocks() == 0);
+		CHECK(arena.size() == 0);
+		CHECK(arena.allocate(1, 1) == first);
+	}
+
+	SECTION("Containers assertion") {
+		CHECK(rsl::MonotonicArena::current() == nullptr);
+		{
+			rsl::ArenaScope scope(arena);
+			CHECK(rsl::MonotonicArena::current() == &arena);
+			rsl::DynamicArray<int, 4, rsl::ArenaAllocator<int>> array;
+			rsl::DynamicList<std::string, 10, rsl::ArenaAllocator<rsl::DoublyListNode<std::string>>> list;
+			for (int i = 0; i < 16; ++i) {
+				array.addBack(i);
+				list.addBack(std::string(40, (char) ('a' + i)));
+			}
+			CHECK(array.length() == 16);
+			CHECK(array.get(15) == 15);
+			CHECK(list.length() == 16);
+			CHECK(list.back() == std::string(40, 'p'));
+			CHECK(arena.blocks() > 0);
+		}
+		CHECK(rsl::MonotonicArena::current() == nullptr);
+		CHECK(arena.blocks() == 0);
+		CHECK(arena.size() == 0);
+		rsl::ArenaAllocator<int> unbound;
+		CHECK(unbound.arena() == nullptr);
+		CHECK(unbound.malloc() == nullptr);
+	}
+}
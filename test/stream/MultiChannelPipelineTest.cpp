@@ -0,0 +1,92 @@
+//
+// Created by robcholz on 11/9/23.
+//
+
+#include <random>
+#include <cmath>
+#include "catch2/catch_test_macros.hpp"
+#include "stream/MultiChannelPipeline.hpp"
+#include "stream/Pipeline.hpp"
+
+
+TEST_CASE("Multi Channel Pipeline Test", "[multi_channel_pipeline]") {
+	constexpr rsl::size_t CHANNELS = 37;
+	using MyPipeline = rsl::Pipeline<int, float, float, 8>;
+	using MyMultiPipeline = rsl::MultiChannelPipeline<int, CHANNELS, float, 8>;
+	MyMultiPipeline multi;
+	MyPipeline single[CHANNELS];
+	std::mt19937 random(17);
+	int in[CHANNELS];
+	float out[CHANNELS];
+
+	SECTION("Initial assertion") {
+		CHECK(multi.isEmpty());
+		CHECK(multi.capacity() == 8);
+		CHECK(multi.channels() == CHANNELS);
+	}
+
+	SECTION("average() assertion") {
+		multi.filter(MyMultiPipeline::Filter::average);
+		for (auto& pipeline: single)
+			pipeline.filter(MyPipeline::Filter::average);
+		for (int tick = 0; tick < 300; ++tick) {
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+				in[channel] = (int) (random() % 1000);
+				single[channel].add(in[channel]);
+				single[channel].update();
+			}
+			multi.update(in, out);
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+				CHECK((int) out[channel] == single[channel].output());
+		}
+		CHECK(multi.length() == 8);
+	}
+
+	SECTION("constrainDiff() IIR() assertion") {
+		MyMultiPipeline iir;
+		multi.filter(MyMultiPipeline::Filter::constrainDiff<20>);
+		iir.filter(MyMultiPipeline::Filter::IIR<30>);
+		MyPipeline singleIIR[CHANNELS];
+		for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+			single[channel].filter(MyPipeline::Filter::constrainDiff<20>);
+			singleIIR[channel].filter(MyPipeline::Filter::IIR<30>);
+		}
+		for (int tick = 0; tick < 300; ++tick) {
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+				in[channel] = (int) (random() % 50);
+				single[channel].add(in[channel]);
+				single[channel].update();
+				singleIIR[channel].add(in[channel]);
+				singleIIR[channel].update();
+			}
+			multi.update(in);
+			iir.update(in);
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+				CHECK(multi.output(channel) == single[channel].output());
+				// single channel pipelines truncate to T
+				CHECK(std::fabs(iir.output(channel) - singleIIR[channel].output()) < 1.f);
+			}
+		}
+	}
+
+	SECTION("kalmanFilter() assertion") {
+		multi.filter(MyMultiPipeline::Filter::kalmanFilter);
+		float estimate[CHANNELS]{}, errorEstimate[CHANNELS];
+		for (float& error: errorEstimate)
+			error = 2.f;
+		for (int tick = 0; tick < 100; ++tick) {
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel) {
+				in[channel] = 100 + (int) (random() % 10);
+				float gain = errorEstimate[channel] / (errorEstimate[channel] + 2.f);
+				float current = estimate[channel] + gain * ((float) in[channel] - estimate[channel]);
+				errorEstimate[channel] = (1.f - gain) * errorEstimate[channel] + std::fabs(estimate[channel] - current) * 0.01f;
+				estimate[channel] = current;
+			}
+			multi.update(in);
+			for (rsl::size_t channel = 0; channel < CHANNELS; ++channel)
+				CHECK(std::fabs(multi.output()[channel] - estimate[channel]) < 1e-3f);
+		}
+		multi.empty();
+		CHECK(multi.output(0) == 0.f);
+	}
+}
@@ -3,10 +3,35 @@
 //
 
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
 #include "catch2/catch_test_macros.hpp"
 #include "stream/Pipeline.hpp"
 
 
+// reference median, same as test/stream/median_filter.py
+static int sortedMedian(const std::vector<int>& samples, size_t windowSize) {
+	size_t begin = samples.size() > windowSize ? samples.size() - windowSize : 0;
+	std::vector<int> window(samples.begin() + (long) begin, samples.end());
+	std::sort(window.begin(), window.end());
+	return window[window.size() / 2];
+}
+
+// reference average of the last windowSize samples, optionally without the minimum and the maximum
+static double windowAverage(const std::vector<int>& samples, size_t windowSize, bool trimmed) {
+	size_t begin = samples.size() > windowSize ? samples.size() - windowSize : 0;
+	std::vector<int> window(samples.begin() + (long) begin, samples.end());
+	std::sort(window.begin(), window.end());
+	if (trimmed && window.size() >= 3)
+		window = std::vector<int>(window.begin() + 1, window.end() - 1);
+	double sum = 0;
+	for (int sample: window)
+		sum += sample;
+	return sum / (double) window.size();
+}
+
+
 TEST_CASE("Pipeline Test", "[pipeline]") {
 	using String = std::string;
 	using MyPipeline = rsl::Pipeline<int, float>;
@@ -18,7 +43,6 @@ TEST_CASE("Pipeline Test", "[pipeline]") {
 	MyPipeline IIR;
 	MyPipeline weightedAvg;
 	MyPipeline jitter;
-	MyPipeline constrained_jitter;
 	MyPipeline kalman;
 
 	SECTION("Init") {
@@ -31,11 +55,326 @@ TEST_CASE("Pipeline Test", "[pipeline]") {
 		IIR.filter(MyPipeline::Filter::IIR<50>);
 		weightedAvg.filter(MyPipeline::Filter::weightedAverage);
 		jitter.filter(MyPipeline::Filter::jitterFilter);
-		constrained_jitter.filter(MyPipeline::Filter::constrainedJitter);
 		kalman.filter(MyPipeline::Filter::kalmanFilter);
 	}
 
 	SECTION("Initial length assertion") {
 
 	}
+
+	SECTION("median() assertion") {
+		median.filter(MyPipeline::Filter::median);
+		std::mt19937 random(42);
+		std::vector<int> samples;
+		for (int i = 0; i < 200; ++i) {
+			samples.push_back((int) (random() % 1000));
+			median.add(samples.back());
+			median.update();
+			CHECK(median.output() == sortedMedian(samples, 10));
+		}
+		CHECK(median.length() == 10);
+	}
+
+	SECTION("median() feedback assertion") {
+		median.filter(MyPipeline::Filter::median);
+		median.feedback(true);
+		std::mt19937 random(13);
+		std::vector<int> fed; // what the container receives, the estimates
+		for (int i = 0; i < 200; ++i) {
+			int sample = (int) (random() % 1000);
+			// the previous estimates with the new sample in place of the newest one
+			std::vector<int> window(fed.end() - (long) std::min<size_t>(fed.size(), 9), fed.end());
+			window.push_back(sample);
+			fed.push_back(sortedMedian(window, 10));
+			median.add(sample);
+			median.update();
+			CHECK(median.output() == fed.back());
+		}
+		std::vector<int> samples(median.window().length());
+		median.window().copyTo(samples.data());
+		CHECK(samples == std::vector<int>(fed.end() - 10, fed.end()));
+
+		// switching filters mid stream starts the engine from the window
+		median.filter(MyPipeline::Filter::IIR<50>);
+		median.filter(MyPipeline::Filter::median);
+		median.feedback(false);
+		samples.push_back(5000);
+		median.add(5000);
+		median.update();
+		CHECK(median.output() == sortedMedian(samples, 10));
+	}
+
+	SECTION("average() medianAverage() assertion") {
+		average.filter(MyPipeline::Filter::average);
+		medianAvg.filter(MyPipeline::Filter::medianAverage);
+		std::mt19937 random(3);
+		std::vector<int> samples;
+		for (int i = 0; i < 200; ++i) {
+			samples.push_back((int) (random() % 1000));
+			average.add(samples.back());
+			average.update();
+			medianAvg.add(samples.back());
+			medianAvg.update();
+			// output() is truncated to T
+			CHECK(average.output() == (int) (float) windowAverage(samples, 10, false));
+			CHECK(medianAvg.output() == (int) (float) windowAverage(samples, 10, true));
+		}
+	}
+
+	SECTION("average() medianAverage() feedback assertion") {
+		average.filter(MyPipeline::Filter::average);
+		medianAvg.filter(MyPipeline::Filter::medianAverage);
+		average.feedback(true);
+		medianAvg.feedback(true);
+		std::mt19937 random(17);
+		std::vector<int> averageFed, medianAvgFed; // what the containers receive, the estimates
+		for (int i = 0; i < 200; ++i) {
+			int sample = (int) (random() % 1000);
+			// the previous estimates with the new sample in place of the newest one
+			std::vector<int> averageWindow(averageFed.end() - (long) std::min<size_t>(averageFed.size(), 9), averageFed.end());
+			std::vector<int> medianAvgWindow(medianAvgFed.end() - (long) std::min<size_t>(medianAvgFed.size(), 9), medianAvgFed.end());
+			averageWindow.push_back(sample);
+			medianAvgWindow.push_back(sample);
+			averageFed.push_back((int) (float) windowAverage(averageWindow, 10, false));
+			medianAvgFed.push_back((int) (float) windowAverage(medianAvgWindow, 10, true));
+			average.add(sample);
+			average.update();
+			medianAvg.add(sample);
+			medianAvg.update();
+			CHECK(average.output() == averageFed.back());
+			CHECK(medianAvg.output() == medianAvgFed.back());
+		}
+		std::vector<int> samples(medianAvg.window().length());
+		medianAvg.window().copyTo(samples.data());
+		CHECK(samples == std::vector<int>(medianAvgFed.end() - 10, medianAvgFed.end()));
+	}
+
+	SECTION("Custom filter assertion") {
+		// custom filters never engage an engine, the wrapped filters work on the window instead
+		MyPipeline customs[3], selected[3];
+		customs[0].filter([](const MyPipeline* pipeline) { return MyPipeline::Filter::median(pipeline); });
+		customs[1].filter([](const MyPipeline* pipeline) { return MyPipeline::Filter::average(pipeline); });
+		customs[2].filter([](const MyPipeline* pipeline) { return MyPipeline::Filter::medianAverage(pipeline); });
+		selected[0].filter(MyPipeline::Filter::median);
+		selected[1].filter(MyPipeline::Filter::average);
+		selected[2].filter(MyPipeline::Filter::medianAverage);
+		for (rsl::size_t p = 0; p < 3; ++p) {
+			customs[p].feedback(p != 1);
+			selected[p].feedback(p != 1);
+		}
+		std::mt19937 random(23);
+		bool matches = true;
+		for (int i = 0; i < 200; ++i) {
+			int sample = (int) (random() % 1000);
+			for (rsl::size_t p = 0; p < 3; ++p) {
+				customs[p].add(sample);
+				customs[p].update();
+				selected[p].add(sample);
+				selected[p].update();
+				matches = matches && customs[p].output() == selected[p].output();
+			}
+		}
+		CHECK(matches);
+
+		MyPipeline spike;
+		spike.filter([](const MyPipeline* pipeline) { return MyPipeline::Filter::median(pipeline); });
+		for (int sample: {5, 5, 5, 5, 900}) {
+			spike.add(sample);
+			spike.update();
+		}
+		CHECK(spike.output() == 5);
+		MyPipeline averaged;
+		averaged.filter([](const MyPipeline* pipeline) { return MyPipeline::Filter::average(pipeline); });
+		for (int sample: {0, 0, 0, 40}) {
+			averaged.add(sample);
+			averaged.update();
+		}
+		CHECK(averaged.output() == 10);
+
+		// a block kernel without its engine runs the per sample path of its filter
+		MyPipeline block, reference;
+		block.filter(MyPipeline::Filter::IIR<50>, MyPipeline::Filter::medianBlock);
+		reference.filter(MyPipeline::Filter::median);
+		int in[64];
+		float out[64];
+		for (int& sample: in)
+			sample = (int) (random() % 1000);
+		block.process(in, out, 64);
+		bool blockMatches = true;
+		for (rsl::size_t i = 0; i < 64; ++i) {
+			reference.add(in[i]);
+			reference.update();
+			blockMatches = blockMatches && out[i] == reference.output();
+		}
+		CHECK(blockMatches);
+		CHECK(block.length() == reference.length());
+	}
+
+	SECTION("process() assertion") {
+		MyPipeline blockPipelines[] = {median, average, medianAvg, IIR, constrained_diff, kalman};
+		MyPipeline samplePipelines[] = {median, average, medianAvg, IIR, constrained_diff, kalman};
+		blockPipelines[0].filter(MyPipeline::Filter::median, MyPipeline::Filter::medianBlock);
+		blockPipelines[1].filter(MyPipeline::Filter::average, MyPipeline::Filter::averageBlock);
+		blockPipelines[2].filter(MyPipeline::Filter::medianAverage, MyPipeline::Filter::medianAverageBlock);
+		blockPipelines[3].filter(MyPipeline::Filter::IIR<30>, MyPipeline::Filter::IIRBlock<30>);
+		blockPipelines[4].filter(MyPipeline::Filter::constrainDiff<50>, MyPipeline::Filter::constrainDiffBlock<50>);
+		blockPipelines[5].filter(MyPipeline::Filter::IIR<80>); // no kernel, per sample fallback
+		samplePipelines[0].filter(MyPipeline::Filter::median);
+		samplePipelines[1].filter(MyPipeline::Filter::average);
+		samplePipelines[2].filter(MyPipeline::Filter::medianAverage);
+		samplePipelines[3].filter(MyPipeline::Filter::IIR<30>);
+		samplePipelines[4].filter(MyPipeline::Filter::constrainDiff<50>);
+		samplePipelines[5].filter(MyPipeline::Filter::IIR<80>);
+
+		std::mt19937 random(5);
+		const rsl::size_t blockSizes[] = {1, 2, 3, 17, 256, 4, 1, 64};
+		int in[256];
+		float out[256];
+		for (rsl::size_t blockSize: blockSizes) {
+			for (rsl::size_t i = 0; i < blockSize; ++i)
+				in[i] = (int) (random() % 200);
+			for (rsl::size_t p = 0; p < 6; ++p) {
+				blockPipelines[p].process(in, out, blockSize);
+				for (rsl::size_t i = 0; i < blockSize; ++i) {
+					samplePipelines[p].add(in[i]);
+					samplePipelines[p].update();
+					CHECK(out[i] == samplePipelines[p].output());
+				}
+				CHECK(blockPipelines[p].length() == samplePipelines[p].length());
+			}
+		}
+	}
+
+	SECTION("window() assertion") {
+		CHECK(jitter.window().isEmpty());
+		jitter.filter(MyPipeline::Filter::jitterFilter);
+		for (int i = 0; i < 25; ++i) {
+			jitter.add(i);
+			jitter.update();
+		}
+		rsl::RingSpan<const int> window = jitter.window();
+		CHECK(window.length() == 10);
+		std::vector<int> samples(window.length());
+		window.copyTo(samples.data());
+		CHECK(samples == std::vector<int>{15, 16, 17, 18, 19, 20, 21, 22, 23, 24});
+		CHECK(window.last(3).front() == 22);
+		const rsl::StaticArray<float, 10> weights{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f};
+		float expected = 0;
+		for (int k = 0; k < 10; ++k)
+			expected += (float) (15 + k) * (float) (k + 1);
+		CHECK(MyPipeline::Filter::weightedAverage(&jitter, weights) == expected);
+	}
+}
+
+TEST_CASE("Weighted Average Test", "[weighted_average]") {
+	using LongPipeline = rsl::Pipeline<int, float, float, 16>;
+	const float defaultWeights[] = {0.05, 0.06, 0.07, 0.08, 0.08, 0.9, 0.11, 0.12, 0.15, 0.19};
+	LongPipeline pipeline;
+
+	SECTION("Window longer than the weights assertion") {
+		pipeline.filter(LongPipeline::Filter::weightedAverage);
+		for (int i = 0; i < 40; ++i) {
+			pipeline.add(i);
+			pipeline.update();
+		}
+		CHECK(pipeline.length() == 16);
+		// update() filters before adding the sample, so the newest 10 of 24 to 38, the oldest 5 get no weight
+		int expected = 0;
+		for (int k = 0; k < 10; ++k)
+			expected += (29 + k) * defaultWeights[k];
+		CHECK(pipeline.output() == expected);
+
+		rsl::StaticArray<float, 16> weights{1.f, 10.f, 100.f, 1000.f, 10000.f};
+		weights.popBack();
+		weights.popBack(); // the stale weights past the length must not be read
+		CHECK(LongPipeline::Filter::weightedAverage(&pipeline, weights) == 37 + 380 + 3900);
+	}
+
+	SECTION("Window shorter than the weights assertion") {
+		for (int i = 1; i <= 4; ++i)
+			pipeline.add(i);
+		int expected = 0;
+		for (int k = 0; k < 4; ++k)
+			expected += (k + 1) * defaultWeights[k];
+		CHECK(LongPipeline::Filter::weightedAverage(&pipeline) == expected);
+	}
+}
+
+TEST_CASE("Sliding Median Test", "[sliding_median]") {
+	rsl::SlidingMedian<int, 64> median64;
+	rsl::SlidingMedian<int, 5> median5;
+
+	SECTION("Empty assertion") {
+		CHECK(median5.isEmpty());
+		CHECK(median5.capacity() == 5);
+	}
+
+	SECTION("Window assertion") {
+		std::mt19937 random(7);
+		std::vector<int> samples;
+		for (int i = 0; i < 1000; ++i) {
+			samples.push_back((int) (random() % 50)); // plenty of duplicates
+			CHECK(median64.filter(samples.back()) == sortedMedian(samples, 64));
+			CHECK(median5.filter(samples.back()) == sortedMedian(samples, 5));
+		}
+		CHECK(median64.length() == 64);
+		median64.empty();
+		CHECK(median64.filter(3) == 3);
+	}
+}
+
+TEST_CASE("Sliding Average Test", "[sliding_average]") {
+	rsl::SlidingAverage<int, long, 7> average7;
+	rsl::SlidingAverage<float, float, 100> average100;
+
+	SECTION("Empty assertion") {
+		CHECK(average7.isEmpty());
+		CHECK(average7.average() == 0);
+		CHECK(average7.capacity() == 7);
+	}
+
+	SECTION("Window assertion") {
+		std::mt19937 random(11);
+		std::vector<int> samples;
+		for (int i = 0; i < 1000; ++i) {
+			samples.push_back((int) (random() % 20) - 10);
+			average7.add(samples.back());
+			std::vector<int> window(samples.end() - (long) std::min<size_t>(samples.size(), 7), samples.end());
+			long sum = 0;
+			for (int sample: window)
+				sum += sample;
+			CHECK(average7.sum() == sum);
+			CHECK(average7.minimum() == *std::min_element(window.begin(), window.end()));
+			CHECK(average7.maximum() == *std::max_element(window.begin(), window.end()));
+		}
+		CHECK(average7.length() == 7);
+	}
+
+	SECTION("Float drift assertion") {
+		// large offset with small noise, a plain running float sum drifts away here
+		for (int i = 0; i < 100000; ++i)
+			average100.add(10000.0f + (float) (i % 10) * 0.01f);
+		CHECK(average100.average() > 10000.0440f);
+		CHECK(average100.average() < 10000.0460f);
+	}
+
+	SECTION("replaceBack() assertion") {
+		std::mt19937 random(19);
+		std::vector<int> samples;
+		for (int i = 0; i < 1000; ++i) {
+			samples.push_back((int) (random() % 20) - 10);
+			average7.add(samples.back());
+			if (i % 3 != 0) {
+				samples.back() = (int) (random() % 20) - 10;
+				average7.replaceBack(samples.back());
+			}
+			std::vector<int> window(samples.end() - (long) std::min<size_t>(samples.size(), 7), samples.end());
+			long sum = 0;
+			for (int sample: window)
+				sum += sample;
+			CHECK(average7.sum() == sum);
+			CHECK(average7.minimum() == *std::min_element(window.begin(), window.end()));
+			CHECK(average7.maximum() == *std::max_element(window.begin(), window.end()));
+		}
+	}
 }
\ No newline at end of file
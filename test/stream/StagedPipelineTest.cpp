@@ -0,0 +1,117 @@
+//
+// Created by robcholz on 11/7/23.
+//
+
+#include <random>
+#include <vector>
+#include <cmath>
+#include "catch2/catch_test_macros.hpp"
+#include "stream/StagedPipeline.hpp"
+#include "stream/SlidingMedian.hpp"
+#include "stream/SlidingAverage.hpp"
+#include "stream/stage/ConstrainStage.hpp"
+#include "stream/stage/IIRStage.hpp"
+#include "stream/stage/FIRStage.hpp"
+
+
+TEST_CASE("Staged Pipeline Test", "[staged_pipeline]") {
+	using Conditioning = rsl::StagedPipeline<int,
+			rsl::ConstrainStage<int, 100>,
+			rsl::SlidingMedian<int, 5>,
+			rsl::IIRStage<int, float, 25>>;
+	Conditioning pipeline;
+
+	SECTION("Stage assertion") {
+		CHECK(pipeline.stages() == 3);
+		CHECK(pipeline.stage<1>().capacity() == 5);
+	}
+
+	SECTION("filter() matches hand chained stages assertion") {
+		rsl::ConstrainStage<int, 100> constrain;
+		rsl::SlidingMedian<int, 5> median;
+		rsl::IIRStage<int, float, 25> iir;
+		std::mt19937 random(9);
+		for (int i = 0; i < 500; ++i) {
+			int sample = (int) (random() % 300);
+			float expected = iir.filter(median.filter(constrain.filter(sample)));
+			CHECK(pipeline.filter(sample) == expected);
+		}
+	}
+
+	SECTION("ConstrainStage assertion") {
+		rsl::ConstrainStage<int, 10> constrain;
+		CHECK(constrain.filter(100) == 100);
+		CHECK(constrain.filter(105) == 105);
+		CHECK(constrain.filter(500) == 105); // spike dropped
+		CHECK(constrain.filter(110) == 110);
+		constrain.empty();
+		CHECK(constrain.filter(500) == 500);
+	}
+
+	SECTION("process() empty() assertion") {
+		rsl::StagedPipeline<int, rsl::SlidingAverage<int, float, 4>> average;
+		const int in[] = {4, 8, 12, 16, 20};
+		float out[5];
+		average.process(in, out, 5);
+		CHECK(out[0] == 4.0f);
+		CHECK(out[1] == 6.0f);
+		CHECK(out[3] == 10.0f);
+		CHECK(out[4] == 14.0f);
+		average.empty();
+		CHECK(average.stage<0>().isEmpty());
+		CHECK(average.filter(2) == 2.0f);
+	}
+}
+
+TEST_CASE("FIR Stage Test", "[fir_stage]") {
+	SECTION("dotProduct() assertion") {
+		std::mt19937 random(1);
+		std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+		for (rsl::size_t length = 0; length < 70; ++length) {
+			std::vector<float> a(length), b(length);
+			double expected = 0;
+			for (rsl::size_t i = 0; i < length; ++i) {
+				a[i] = distribution(random);
+				b[i] = distribution(random);
+				expected += (double) a[i] * b[i];
+			}
+			CHECK(std::fabs(rsl::dotProduct(a.data(), b.data(), length) - expected) < 1e-4);
+		}
+		const int x[] = {1, 2, 3}, y[] = {4, 5, 6};
+		CHECK(rsl::dotProduct(x, y, 3) == 32);
+	}
+
+	SECTION("filter() matches direct convolution assertion") {
+		constexpr rsl::size_t TAPS = 67;
+		std::mt19937 random(2);
+		std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+		float coefficients[TAPS];
+		for (float& coefficient: coefficients)
+			coefficient = distribution(random);
+		rsl::FIRStage<float, TAPS> fir;
+		fir.taps(coefficients);
+		std::vector<float> samples;
+		for (int i = 0; i < 300; ++i) {
+			samples.push_back(distribution(random));
+			double expected = 0;
+			for (rsl::size_t k = 0; k < TAPS; ++k) {
+				long index = (long) samples.size() - (long) TAPS + (long) k;
+				if (index >= 0)
+					expected += (double) coefficients[k] * samples[(size_t) index];
+			}
+			CHECK(std::fabs(fir.filter(samples.back()) - expected) < 1e-4);
+		}
+		fir.empty();
+		CHECK(fir.filter(1.f) == coefficients[TAPS - 1]);
+	}
+
+	SECTION("Staged assertion") {
+		rsl::StagedPipeline<int, rsl::FIRStage<int, 3>> pipeline;
+		const float coefficients[] = {0.25f, 0.25f, 0.5f};
+		pipeline.stage<0>().taps(coefficients);
+		CHECK(pipeline.filter(4) == 2.f);
+		CHECK(pipeline.filter(8) == 5.f);
+		CHECK(pipeline.filter(4) == 5.f);
+		CHECK(pipeline.filter(0) == 3.f);
+	}
+}